@@ -7,13 +7,27 @@
 
 #include "JSDeltaBundleClient.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
+
+#include <folly/Bits.h>
 
 namespace facebook {
 namespace react {
 
 namespace {
+
+/*
+ * Size of chunks module code is stored in; larger modules get a chunk of
+ * their own.
+ */
+constexpr size_t kChunkSize = 1 << 20;
+
+constexpr uint32_t kBinaryDeltaBaseFlag = 1 << 0;
+
 std::string startupCode(const folly::dynamic *pre, const folly::dynamic *post) {
   std::ostringstream startupCode;
 
@@ -25,13 +39,85 @@ std::string startupCode(const folly::dynamic *pre, const folly::dynamic *post) {
 
   return startupCode.str();
 }
+
+/*
+ * Shares the startup code between all callers of `getStartupCode`
+ * instead of copying it for every one of them.
+ */
+class SharedJSBigString : public JSBigString {
+ public:
+  SharedJSBigString(std::shared_ptr<const JSBigString> string)
+      : string_(std::move(string)) {}
+
+  bool isAscii() const override {
+    return string_->isAscii();
+  }
+
+  const char *c_str() const override {
+    return string_->c_str();
+  }
+
+  size_t size() const override {
+    return string_->size();
+  }
+
+ private:
+  std::shared_ptr<const JSBigString> string_;
+};
+
+class BinaryDeltaReader {
+ public:
+  BinaryDeltaReader(const char *data, size_t size)
+      : data_(data), size_(size) {}
+
+  uint32_t readUInt32() {
+    uint32_t value;
+    std::memcpy(&value, read(sizeof(value)), sizeof(value));
+    return folly::Endian::little(value);
+  }
+
+  const char *read(size_t size) {
+    if (size > size_ - offset_) {
+      throw std::invalid_argument(folly::to<std::string>(
+          "Unexpected end of binary delta at offset ", offset_));
+    }
+    auto data = data_ + offset_;
+    offset_ += size;
+    return data;
+  }
+
+  size_t remaining() const {
+    return size_ - offset_;
+  }
+
+  bool isAtEnd() const {
+    return offset_ == size_;
+  }
+
+ private:
+  const char *data_;
+  size_t size_;
+  size_t offset_{0};
+};
+
 } // namespace
 
+constexpr uint32_t JSDeltaBundleClient::kBinaryDeltaMagicNumber;
+
+bool JSDeltaBundleClient::isBinaryDelta(const char *data, size_t size) {
+  uint32_t magicNumber;
+  if (size < sizeof(magicNumber)) {
+    return false;
+  }
+  std::memcpy(&magicNumber, data, sizeof(magicNumber));
+  return folly::Endian::little(magicNumber) == kBinaryDeltaMagicNumber;
+}
+
 void JSDeltaBundleClient::patchModules(const folly::dynamic *modules) {
   for (const folly::dynamic &pair : *modules) {
     auto id = pair[0].getInt();
-    auto module = pair[1];
-    modules_[id] = std::move(module.getString());
+    auto const &module = pair[1].getString();
+    setModule(id, module.data(), module.size());
   }
 }
 
@@ -44,17 +130,18 @@ void JSDeltaBundleClient::patch(const folly::dynamic &delta) {
     auto const pre = delta.get_ptr("pre");
     auto const post = delta.get_ptr("post");
 
-    startupCode_ = startupCode(pre, post);
+    startupCode_ = std::make_shared<JSBigStdString>(startupCode(pre, post));
 
     const folly::dynamic *modules = delta.get_ptr("modules");
     if (modules != nullptr) {
+      modules_.reserve(modules->size());
       patchModules(modules);
     }
   } else {
     const folly::dynamic *deleted = delta.get_ptr("deleted");
     if (deleted != nullptr) {
       for (const folly::dynamic &id : *deleted) {
-        modules_.erase(id.getInt());
+        deleteModule(id.getInt());
       }
     }
 
@@ -74,26 +161,151 @@ void JSDeltaBundleClient::patch(const folly::dynamic &delta) {
     if (modified != nullptr) {
       patchModules(modified);
     }
+
+    compactIfNeeded();
   }
 }
 
+void JSDeltaBundleClient::patch(const char *data, size_t size) {
+  if (!isBinaryDelta(data, size)) {
+    throw std::invalid_argument("Binary delta has an invalid magic number");
+  }
+
+  auto reader = BinaryDeltaReader{data, size};
+  reader.readUInt32();
+  auto flags = reader.readUInt32();
+
+  if (flags & kBinaryDeltaBaseFlag) {
+    clear();
+
+    auto preLength = reader.readUInt32();
+    auto pre = reader.read(preLength);
+    auto postLength = reader.readUInt32();
+    auto post = reader.read(postLength);
+
+    auto startupCode = std::make_unique<JSBigBufferString>(
+        preLength + 1 + postLength + 1);
+    auto buffer = startupCode->data();
+    std::memcpy(buffer, pre, preLength);
+    buffer[preLength] = '\n';
+    std::memcpy(buffer + preLength + 1, post, postLength);
+    buffer[preLength + 1 + postLength] = '\n';
+    startupCode_ = std::move(startupCode);
+  }
+
+  auto deletedCount = reader.readUInt32();
+  for (uint32_t i = 0; i < deletedCount; i++) {
+    deleteModule(reader.readUInt32());
+  }
+
+  auto modulesCount = reader.readUInt32();
+  // Every module takes at least its id and length, so a larger count cannot
+  // be satisfied by the rest of the delta; reject it before reserving.
+  if (modulesCount > reader.remaining() / (2 * sizeof(uint32_t))) {
+    throw std::invalid_argument("Binary delta has more modules than data");
+  }
+  modules_.reserve(modules_.size() + modulesCount);
+  for (uint32_t i = 0; i < modulesCount; i++) {
+    auto id = reader.readUInt32();
+    auto length = reader.readUInt32();
+    setModule(id, reader.read(length), length);
+  }
+
+  if (!reader.isAtEnd()) {
+    throw std::invalid_argument("Unexpected data at the end of binary delta");
+  }
+
+  compactIfNeeded();
+}
+
 JSModulesUnbundle::Module JSDeltaBundleClient::getModule(
     uint32_t moduleId) const {
   auto search = modules_.find(moduleId);
   if (search != modules_.end()) {
-    return {folly::to<std::string>(search->first, ".js"), search->second};
+    return {folly::to<std::string>(search->first, ".js"),
+            std::string(search->second.code, search->second.length)};
   }
 
   throw JSModulesUnbundle::ModuleNotFound(moduleId);
 }
 
 std::unique_ptr<const JSBigString> JSDeltaBundleClient::getStartupCode() const {
-  return std::make_unique<JSBigStdString>(startupCode_);
+  if (!startupCode_) {
+    return std::make_unique<JSBigStdString>("");
+  }
+  return std::make_unique<SharedJSBigString>(startupCode_);
 }
 
 void JSDeltaBundleClient::clear() {
   modules_.clear();
-  startupCode_.clear();
+  startupCode_.reset();
+  chunks_.clear();
+  chunkOffset_ = 0;
+  chunkSize_ = 0;
+  allocatedBytes_ = 0;
+  liveBytes_ = 0;
+}
+
+void JSDeltaBundleClient::setModule(
+    uint32_t moduleId,
+    const char *code,
+    size_t length) {
+  auto &slot = modules_[moduleId];
+
+  if (slot.code == nullptr || slot.capacity < length) {
+    liveBytes_ -= slot.capacity;
+    slot.code = allocate(length);
+    slot.capacity = length;
+    liveBytes_ += length;
+  }
+
+  std::memcpy(slot.code, code, length);
+  slot.length = length;
+}
+
+void JSDeltaBundleClient::deleteModule(uint32_t moduleId) {
+  auto search = modules_.find(moduleId);
+  if (search == modules_.end()) {
+    return;
+  }
+
+  liveBytes_ -= search->second.capacity;
+  modules_.erase(search);
+}
+
+char *JSDeltaBundleClient::allocate(size_t size) {
+  if (chunks_.empty() || chunkSize_ - chunkOffset_ < size) {
+    chunkSize_ = std::max(kChunkSize, size);
+    chunks_.push_back(std::unique_ptr<char[]>(new char[chunkSize_]));
+    chunkOffset_ = 0;
+  }
+
+  auto memory = chunks_.back().get() + chunkOffset_;
+  chunkOffset_ += size;
+  allocatedBytes_ += size;
+  return memory;
+}
+
+void JSDeltaBundleClient::compactIfNeeded() {
+  if (allocatedBytes_ - liveBytes_ <= std::max(liveBytes_, kChunkSize)) {
+    return;
+  }
+
+  auto chunks = std::move(chunks_);
+  chunks_.clear();
+  chunkOffset_ = 0;
+  chunkSize_ = 0;
+  allocatedBytes_ = 0;
+  liveBytes_ = 0;
+
+  for (auto &pair : modules_) {
+    auto &slot = pair.second;
+    auto code = allocate(slot.length);
+    std::memcpy(code, slot.code, slot.length);
+    slot.code = code;
+    slot.capacity = slot.length;
+    liveBytes_ += slot.length;
+  }
 }
 
 } // namespace react
@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSModulesUnbundle.h>
@@ -19,18 +20,78 @@
 namespace facebook {
 namespace react {
 
+/*
+ * Keeps the modules and the startup code of a bundle served as deltas.
+ *
+ * Deltas are accepted either as JSON (`folly::dynamic`) or in the binary
+ * format, which avoids parsing megabytes of JSON on every reload. The binary
+ * format consists of little-endian `uint32_t` values and raw bytes:
+ *
+ *   magic number (`kBinaryDeltaMagicNumber`)
+ *   flags (bit 0: the delta is a base one, i.e. replaces everything)
+ *   [base only] length of `pre`, `pre`
+ *   [base only] length of `post`, `post`
+ *   number of deleted modules, ids of deleted modules
+ *   number of added or modified modules,
+ *     then for every module: id, length of the code, the code
+ *
+ * Module code is kept in large chunks of memory instead of separate strings:
+ * modified modules that fit in their previous slot are overwritten in place,
+ * and memory of replaced and deleted modules is reclaimed by compacting the
+ * chunks once it exceeds the memory used by live modules.
+ */
 class JSDeltaBundleClient {
  public:
+  static constexpr uint32_t kBinaryDeltaMagicNumber = 0x42444E52; // "RNDB"
+
+  /*
+   * Returns true if the given data starts with the binary delta magic number.
+   */
+  static bool isBinaryDelta(const char *data, size_t size);
+
   void patch(const folly::dynamic &delta);
+
+  /*
+   * Applies a delta in the binary format.
+   * Throws `std::invalid_argument` if the delta is malformed; in that case
+   * the client may contain a part of the delta.
+   */
+  void patch(const char *data, size_t size);
+
   JSModulesUnbundle::Module getModule(uint32_t moduleId) const;
   std::unique_ptr<const JSBigString> getStartupCode() const;
   void clear();
 
  private:
-  std::unordered_map<uint32_t, std::string> modules_;
-  std::string startupCode_;
+  struct ModuleSlot {
+    char *code;
+    uint32_t length;
+    uint32_t capacity;
+  };
+
+  std::unordered_map<uint32_t, ModuleSlot> modules_;
+  std::shared_ptr<const JSBigString> startupCode_;
+
+  /*
+   * Memory which module code is stored in; only the last chunk has free
+   * space (starting at `chunkOffset_`).
+   */
+  std::vector<std::unique_ptr<char[]>> chunks_;
+  size_t chunkOffset_{0};
+  size_t chunkSize_{0};
+
+  /*
+   * Total capacity of all slots ever allocated in `chunks_` and of slots
+   * of live modules.
+   */
+  size_t allocatedBytes_{0};
+  size_t liveBytes_{0};
 
   void patchModules(const folly::dynamic *delta);
+  void setModule(uint32_t moduleId, const char *code, size_t length);
+  void deleteModule(uint32_t moduleId);
+  char *allocate(size_t size);
+  void compactIfNeeded();
 };
 
 class JSDeltaBundleClientRAMBundle : public JSModulesUnbundle {
@@ -90,6 +90,28 @@ folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
     const std::string &name) {
   SystraceSection s("ModuleRegistry::getConfig", "module", name);
 
+  auto index = getModuleIndex(name);
+  if (!index.hasValue()) {
+    return folly::none;
+  }
+
+  // string name, object constants, array methodNames (methodId is index),
+  // [array promiseMethodIds], [array syncMethodIds]
+  folly::dynamic config = folly::dynamic::array(name, getConstants(*index));
+  for (auto &item : getMethodsConfig(*index)) {
+    config.push_back(std::move(item));
+  }
+
+  if (config.size() == 2 && config[1].empty()) {
+    // no constants or methods
+    return folly::none;
+  } else {
+    return ModuleConfig{*index, config};
+  }
+}
+
+folly::Optional<size_t> ModuleRegistry::getModuleIndex(
+    const std::string &name) {
   // Initialize modulesByName_
   if (modulesByName_.empty() && !modules_.empty()) {
     moduleNames();
@@ -107,55 +129,53 @@ folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
       return folly::none;
     }
   }
-  size_t index = it->second;
 
+  CHECK(it->second < modules_.size());
+  return it->second;
+}
+
+folly::dynamic ModuleRegistry::getConstants(size_t index) {
   CHECK(index < modules_.size());
   NativeModule *module = modules_[index].get();
 
-  // string name, object constants, array methodNames (methodId is index),
-  // [array promiseMethodIds], [array syncMethodIds]
-  folly::dynamic config = folly::dynamic::array(name);
+  SystraceSection s_(
+      "ModuleRegistry::getConstants", "module", module->getName());
+  return module->getConstants();
+}
 
-  {
-    SystraceSection s_("ModuleRegistry::getConstants", "module", name);
-    config.push_back(module->getConstants());
-  }
+folly::dynamic ModuleRegistry::getMethodsConfig(size_t index) {
+  CHECK(index < modules_.size());
+  NativeModule *module = modules_[index].get();
 
-  {
-    SystraceSection s_("ModuleRegistry::getMethods", "module", name);
-    std::vector<MethodDescriptor> methods = module->getMethods();
-
-    folly::dynamic methodNames = folly::dynamic::array;
-    folly::dynamic promiseMethodIds = folly::dynamic::array;
-    folly::dynamic syncMethodIds = folly::dynamic::array;
-
-    for (auto &descriptor : methods) {
-      // TODO: #10487027 compare tags instead of doing string comparison?
-      methodNames.push_back(std::move(descriptor.name));
-      if (descriptor.type == "promise") {
-        promiseMethodIds.push_back(methodNames.size() - 1);
-      } else if (descriptor.type == "sync") {
-        syncMethodIds.push_back(methodNames.size() - 1);
-      }
+  SystraceSection s_(
+      "ModuleRegistry::getMethods", "module", module->getName());
+  std::vector<MethodDescriptor> methods = module->getMethods();
+
+  folly::dynamic methodNames = folly::dynamic::array;
+  folly::dynamic promiseMethodIds = folly::dynamic::array;
+  folly::dynamic syncMethodIds = folly::dynamic::array;
+
+  for (auto &descriptor : methods) {
+    // TODO: #10487027 compare tags instead of doing string comparison?
+    methodNames.push_back(std::move(descriptor.name));
+    if (descriptor.type == "promise") {
+      promiseMethodIds.push_back(methodNames.size() - 1);
+    } else if (descriptor.type == "sync") {
+      syncMethodIds.push_back(methodNames.size() - 1);
     }
+  }
 
-    if (!methodNames.empty()) {
-      config.push_back(std::move(methodNames));
-      if (!promiseMethodIds.empty() || !syncMethodIds.empty()) {
-        config.push_back(std::move(promiseMethodIds));
-        if (!syncMethodIds.empty()) {
-          config.push_back(std::move(syncMethodIds));
-        }
+  folly::dynamic config = folly::dynamic::array;
+  if (!methodNames.empty()) {
+    config.push_back(std::move(methodNames));
+    if (!promiseMethodIds.empty() || !syncMethodIds.empty()) {
+      config.push_back(std::move(promiseMethodIds));
+      if (!syncMethodIds.empty()) {
+        config.push_back(std::move(syncMethodIds));
       }
     }
   }
-
-  if (config.size() == 2 && config[1].empty()) {
-    // no constants or methods
-    return folly::none;
-  } else {
-    return ModuleConfig{index, config};
-  }
+  return config;
 }
 
 void ModuleRegistry::callNativeMethod(
@@ -49,6 +49,15 @@ class RN_EXPORT ModuleRegistry {
 
   folly::Optional<ModuleConfig> getConfig(const std::string &name);
 
+  // The parts of getConfig, for callers which generate the config lazily.
+  // getModuleIndex returns the index (the module id) of a registered module,
+  // getMethodsConfig returns what follows the constants in the config (an
+  // empty array if the module has no methods). Constants are usually the
+  // expensive part, getMethodsConfig does not touch them.
+  folly::Optional<size_t> getModuleIndex(const std::string &name);
+  folly::dynamic getConstants(size_t index);
+  folly::dynamic getMethodsConfig(size_t index);
+
   void callNativeMethod(
       unsigned int moduleId,
       unsigned int methodId,
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ReactMarkerTimeline.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <folly/dynamic.h>
+#include <folly/json.h>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+enum class MarkerKind { Start, Stop };
+
+struct MarkerInfo {
+  const char *name;
+  MarkerKind kind;
+};
+
+MarkerInfo getMarkerInfo(ReactMarker::ReactMarkerId markerId) {
+  switch (markerId) {
+    case ReactMarker::NATIVE_REQUIRE_START:
+      return {"NATIVE_REQUIRE", MarkerKind::Start};
+    case ReactMarker::NATIVE_REQUIRE_STOP:
+      return {"NATIVE_REQUIRE", MarkerKind::Stop};
+    case ReactMarker::RUN_JS_BUNDLE_START:
+      return {"RUN_JS_BUNDLE", MarkerKind::Start};
+    case ReactMarker::RUN_JS_BUNDLE_STOP:
+      return {"RUN_JS_BUNDLE", MarkerKind::Stop};
+    case ReactMarker::CREATE_REACT_CONTEXT_STOP:
+      return {"CREATE_REACT_CONTEXT", MarkerKind::Stop};
+    case ReactMarker::JS_BUNDLE_STRING_CONVERT_START:
+      return {"JS_BUNDLE_STRING_CONVERT", MarkerKind::Start};
+    case ReactMarker::JS_BUNDLE_STRING_CONVERT_STOP:
+      return {"JS_BUNDLE_STRING_CONVERT", MarkerKind::Stop};
+    case ReactMarker::NATIVE_MODULE_SETUP_START:
+      return {"NATIVE_MODULE_SETUP", MarkerKind::Start};
+    case ReactMarker::NATIVE_MODULE_SETUP_STOP:
+      return {"NATIVE_MODULE_SETUP", MarkerKind::Stop};
+    case ReactMarker::REGISTER_JS_SEGMENT_START:
+      return {"REGISTER_JS_SEGMENT", MarkerKind::Start};
+    case ReactMarker::REGISTER_JS_SEGMENT_STOP:
+      return {"REGISTER_JS_SEGMENT", MarkerKind::Stop};
+  }
+  return {"UNKNOWN", MarkerKind::Stop};
+}
+
+double toMicroseconds(ReactMarkerTimeline::Clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+std::string getEventName(const std::string &name, const std::string &tag) {
+  return tag.empty() ? name : name + ": " + tag;
+}
+
+ReactMarker::LogTaggedMarker &getPreviousLogTaggedMarker() {
+  static ReactMarker::LogTaggedMarker previousLogTaggedMarker = nullptr;
+  return previousLogTaggedMarker;
+}
+
+void logTaggedMarkerIntoSharedTimeline(
+    const ReactMarker::ReactMarkerId markerId,
+    const char *tag) {
+  ReactMarkerTimeline::shared().logMarker(markerId, tag);
+
+  auto &previousLogTaggedMarker = getPreviousLogTaggedMarker();
+  if (previousLogTaggedMarker) {
+    previousLogTaggedMarker(markerId, tag);
+  }
+}
+
+} // namespace
+
+void ReactMarkerTimeline::logMarker(
+    ReactMarker::ReactMarkerId markerId,
+    const char *tag) {
+  logMarker(markerId, tag, Clock::now());
+}
+
+void ReactMarkerTimeline::logMarker(
+    ReactMarker::ReactMarkerId markerId,
+    const char *tag,
+    Clock::time_point time) {
+  auto info = getMarkerInfo(markerId);
+  auto key =
+      std::make_pair(std::string{info.name}, std::string{tag ? tag : ""});
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (!hasOrigin_) {
+    hasOrigin_ = true;
+    origin_ = time;
+  }
+
+  if (info.kind == MarkerKind::Start) {
+    pendingStarts_[key].push_back(time);
+    return;
+  }
+
+  auto iterator = pendingStarts_.find(key);
+  if (iterator == pendingStarts_.end()) {
+    instantMarkers_.push_back(
+        InstantMarker{std::move(key.first), std::move(key.second), time});
+    return;
+  }
+
+  // Markers with the same name and tag can nest (e.g. a module which is
+  // required while it is being required), the innermost one stops first.
+  auto start = iterator->second.back();
+  iterator->second.pop_back();
+  if (iterator->second.empty()) {
+    pendingStarts_.erase(iterator);
+  }
+
+  spans_.push_back(
+      Span{std::move(key.first), std::move(key.second), start, time});
+}
+
+std::vector<ReactMarkerTimeline::Span> ReactMarkerTimeline::getSpans() const {
+  std::vector<Span> spans;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    spans = spans_;
+  }
+
+  std::stable_sort(
+      spans.begin(), spans.end(), [](const Span &lhs, const Span &rhs) {
+        return lhs.start < rhs.start;
+      });
+  return spans;
+}
+
+std::vector<ReactMarkerTimeline::Phase> ReactMarkerTimeline::getPhases()
+    const {
+  std::vector<Phase> phases;
+  std::unordered_map<std::string, size_t> nameToIndex;
+
+  for (const auto &span : getSpans()) {
+    auto iterator = nameToIndex.find(span.name);
+    if (iterator == nameToIndex.end()) {
+      iterator = nameToIndex.emplace(span.name, phases.size()).first;
+      phases.push_back(
+          Phase{span.name, 0, Clock::duration{0}, Clock::duration{0}});
+    }
+
+    auto &phase = phases[iterator->second];
+    auto duration = span.getDuration();
+    phase.count++;
+    phase.totalDuration += duration;
+    phase.maxDuration = std::max(phase.maxDuration, duration);
+  }
+
+  std::stable_sort(
+      phases.begin(), phases.end(), [](const Phase &lhs, const Phase &rhs) {
+        return lhs.totalDuration > rhs.totalDuration;
+      });
+  return phases;
+}
+
+std::vector<ReactMarkerTimeline::Span> ReactMarkerTimeline::getCriticalPath()
+    const {
+  auto spans = getSpans();
+  if (spans.empty()) {
+    return {};
+  }
+
+  // Among spans which end at the same time, the one which starts first
+  // (i.e. the outermost one) is the last in this order.
+  std::sort(spans.begin(), spans.end(), [](const Span &lhs, const Span &rhs) {
+    return lhs.end < rhs.end || (lhs.end == rhs.end && lhs.start > rhs.start);
+  });
+
+  std::vector<Span> criticalPath;
+  auto iterator = spans.end();
+  do {
+    auto const last = iterator - 1;
+    const auto &span = *last;
+    criticalPath.push_back(span);
+
+    // The first span before `span` which ends after `span` starts. `span`
+    // itself is excluded from the search: a zero-length span does not end
+    // after it starts and would be found again, looping forever.
+    iterator = std::upper_bound(
+        spans.begin(),
+        last,
+        span.start,
+        [](Clock::time_point time, const Span &candidate) {
+          return time < candidate.end;
+        });
+  } while (iterator != spans.begin());
+
+  std::reverse(criticalPath.begin(), criticalPath.end());
+  return criticalPath;
+}
+
+std::string ReactMarkerTimeline::getChromeTrace() const {
+  auto spans = getSpans();
+
+  std::vector<InstantMarker> instantMarkers;
+  Clock::time_point origin;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    instantMarkers = instantMarkers_;
+    origin = origin_;
+  }
+
+  auto events = folly::dynamic::array();
+
+  for (const auto &span : spans) {
+    auto event =
+        folly::dynamic::object("name", getEventName(span.name, span.tag))(
+            "cat", "ReactMarker")("ph", "X")("pid", 0)("tid", 0)(
+            "ts", toMicroseconds(span.start - origin))(
+            "dur", toMicroseconds(span.getDuration()));
+    events.push_back(std::move(event));
+  }
+
+  for (const auto &marker : instantMarkers) {
+    auto event =
+        folly::dynamic::object("name", getEventName(marker.name, marker.tag))(
+            "cat", "ReactMarker")("ph", "i")("s", "p")("pid", 0)("tid", 0)(
+            "ts", toMicroseconds(marker.time - origin));
+    events.push_back(std::move(event));
+  }
+
+  return folly::toJson(folly::dynamic::object("traceEvents", events));
+}
+
+void ReactMarkerTimeline::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  hasOrigin_ = false;
+  spans_.clear();
+  instantMarkers_.clear();
+  pendingStarts_.clear();
+}
+
+void ReactMarkerTimeline::install() {
+  static std::once_flag onceFlag;
+  std::call_once(onceFlag, []() {
+    getPreviousLogTaggedMarker() = ReactMarker::logTaggedMarker;
+    ReactMarker::logTaggedMarker = logTaggedMarkerIntoSharedTimeline;
+  });
+}
+
+ReactMarkerTimeline &ReactMarkerTimeline::shared() {
+  static auto timeline = new ReactMarkerTimeline();
+  return *timeline;
+}
+
+} // namespace react
+} // namespace facebook
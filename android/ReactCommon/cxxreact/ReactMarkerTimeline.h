@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cxxreact/ReactMarker.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Records `ReactMarker` events and turns them into a startup timeline:
+ * matching START and STOP markers (with the same tag, if any) are paired
+ * into spans, from which per-phase durations and the critical path are
+ * computed. The timeline can be exported in the Chrome Trace Event Format
+ * (loadable by chrome://tracing or Perfetto, and easy to diff in CI).
+ * All methods are thread-safe.
+ */
+class ReactMarkerTimeline {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /*
+   * A pair of matching START and STOP markers.
+   */
+  struct Span {
+    std::string name; // The marker without `_START`, e.g. `NATIVE_REQUIRE`.
+    std::string tag; // Empty if the markers were not tagged.
+    Clock::time_point start;
+    Clock::time_point end;
+
+    Clock::duration getDuration() const {
+      return end - start;
+    }
+  };
+
+  /*
+   * Accumulated spans of one kind (e.g. all `NATIVE_MODULE_SETUP` spans).
+   */
+  struct Phase {
+    std::string name;
+    int count;
+    Clock::duration totalDuration;
+    Clock::duration maxDuration;
+  };
+
+  /*
+   * Records a marker which happened at the given time (now by default).
+   */
+  void logMarker(ReactMarker::ReactMarkerId markerId, const char *tag);
+  void logMarker(
+      ReactMarker::ReactMarkerId markerId,
+      const char *tag,
+      Clock::time_point time);
+
+  /*
+   * Returns all completed spans, ordered by start time.
+   */
+  std::vector<Span> getSpans() const;
+
+  /*
+   * Returns durations of all phases, the longest (in total) first.
+   */
+  std::vector<Phase> getPhases() const;
+
+  /*
+   * Returns the chain of spans that determines when the latest span ends:
+   * starting with that span, each preceding span is the one that ends last
+   * before the following one starts (spans which are nested in or overlap
+   * with the chain are not on it). Ordered by start time.
+   */
+  std::vector<Span> getCriticalPath() const;
+
+  /*
+   * Returns the timeline in the Chrome Trace Event Format (JSON).
+   * Spans become complete ("X") events, markers without a START
+   * counterpart (e.g. `CREATE_REACT_CONTEXT_STOP`) become instant events.
+   * Timestamps are relative to the first recorded marker.
+   */
+  std::string getChromeTrace() const;
+
+  /*
+   * Forgets all recorded markers.
+   */
+  void clear();
+
+  /*
+   * Makes `ReactMarker::logTaggedMarker` record all markers into the
+   * shared timeline; markers are still forwarded to the previously
+   * installed callback (if any). Must be called after the platform
+   * installs its own callback.
+   */
+  static void install();
+
+  /*
+   * The timeline which `install` makes record markers.
+   */
+  static ReactMarkerTimeline &shared();
+
+ private:
+  struct InstantMarker {
+    std::string name;
+    std::string tag;
+    Clock::time_point time;
+  };
+
+  mutable std::mutex mutex_;
+  bool hasOrigin_{false};
+  Clock::time_point origin_{};
+  std::vector<Span> spans_{};
+  std::vector<InstantMarker> instantMarkers_{};
+
+  /*
+   * START markers which have no STOP counterpart yet, by name and tag.
+   */
+  std::map<std::pair<std::string, std::string>, std::vector<Clock::time_point>>
+      pendingStarts_{};
+};
+
+} // namespace react
+} // namespace facebook
@@ -10,6 +10,9 @@
 #include <exception>
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <cxxreact/JSDeltaBundleClient.h>
 #include <folly/dynamic.h>
@@ -17,6 +20,66 @@
 
 using namespace facebook::react;
 
+namespace {
+
+class BinaryDeltaBuilder {
+ public:
+  BinaryDeltaBuilder(bool base) {
+    writeUInt32(JSDeltaBundleClient::kBinaryDeltaMagicNumber);
+    writeUInt32(base ? 1 : 0);
+  }
+
+  BinaryDeltaBuilder &startupCode(
+      const std::string &pre,
+      const std::string &post) {
+    writeString(pre);
+    writeString(post);
+    return *this;
+  }
+
+  BinaryDeltaBuilder &deleted(const std::vector<uint32_t> &ids) {
+    writeUInt32(ids.size());
+    for (auto id : ids) {
+      writeUInt32(id);
+    }
+    return *this;
+  }
+
+  BinaryDeltaBuilder &modules(
+      const std::vector<std::pair<uint32_t, std::string>> &modules) {
+    writeUInt32(modules.size());
+    for (const auto &module : modules) {
+      writeUInt32(module.first);
+      writeString(module.second);
+    }
+    return *this;
+  }
+
+  void applyTo(JSDeltaBundleClient &client) const {
+    client.patch(data_.data(), data_.size());
+  }
+
+  const std::string &data() const {
+    return data_;
+  }
+
+ private:
+  std::string data_;
+
+  void writeUInt32(uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+      data_.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+  }
+
+  void writeString(const std::string &string) {
+    writeUInt32(string.size());
+    data_ += string;
+  }
+};
+
+} // namespace
+
 TEST(JSDeltaBundleClient, PatchStartupCode) {
   JSDeltaBundleClient client;
 
@@ -131,3 +194,93 @@ TEST(JSDeltaBundleClient, Clear) {
 
   EXPECT_STREQ(client.getStartupCode()->c_str(), "");
 }
+
+TEST(JSDeltaBundleClient, PatchBinary) {
+  JSDeltaBundleClient client;
+
+  BinaryDeltaBuilder(true)
+      .startupCode("pre", "post")
+      .deleted({})
+      .modules({{0, "0"}, {1, "1"}, {2, "2"}})
+      .applyTo(client);
+
+  EXPECT_STREQ(client.getStartupCode()->c_str(), "pre\npost\n");
+  EXPECT_EQ(client.getModule(0).code, "0");
+  EXPECT_EQ(client.getModule(1).code, "1");
+  EXPECT_EQ(client.getModule(2).code, "2");
+
+  BinaryDeltaBuilder(false)
+      .deleted({1})
+      .modules({{0, "modified and longer"}, {2, ""}, {3, "3"}})
+      .applyTo(client);
+
+  EXPECT_STREQ(client.getStartupCode()->c_str(), "pre\npost\n");
+  EXPECT_EQ(client.getModule(0).code, "modified and longer");
+  ASSERT_THROW(client.getModule(1), JSModulesUnbundle::ModuleNotFound);
+  EXPECT_EQ(client.getModule(2).code, "");
+  EXPECT_EQ(client.getModule(3).code, "3");
+
+  BinaryDeltaBuilder(false).deleted({}).modules({{0, "0.2"}}).applyTo(client);
+  EXPECT_EQ(client.getModule(0).code, "0.2");
+
+  BinaryDeltaBuilder(true)
+      .startupCode("pre2", "post2")
+      .deleted({})
+      .modules({{4, "4"}})
+      .applyTo(client);
+
+  EXPECT_STREQ(client.getStartupCode()->c_str(), "pre2\npost2\n");
+  ASSERT_THROW(client.getModule(0), JSModulesUnbundle::ModuleNotFound);
+  EXPECT_EQ(client.getModule(4).code, "4");
+}
+
+TEST(JSDeltaBundleClient, PatchBinaryRepeatedly) {
+  JSDeltaBundleClient client;
+
+  auto modules = std::vector<std::pair<uint32_t, std::string>>{};
+  for (uint32_t id = 0; id < 100; id++) {
+    modules.push_back({id, std::string(1000, 'a')});
+  }
+  BinaryDeltaBuilder(true)
+      .startupCode("", "")
+      .deleted({})
+      .modules(modules)
+      .applyTo(client);
+
+  // Every module outgrows its slot, so memory of old slots gets reclaimed.
+  for (int revision = 1; revision <= 50; revision++) {
+    for (auto &module : modules) {
+      module.second = std::string(1000 + revision * 100, 'a' + revision % 26);
+    }
+    BinaryDeltaBuilder(false).deleted({}).modules(modules).applyTo(client);
+  }
+
+  for (const auto &module : modules) {
+    EXPECT_EQ(client.getModule(module.first).code, module.second);
+  }
+}
+
+TEST(JSDeltaBundleClient, PatchMalformedBinary) {
+  JSDeltaBundleClient client;
+
+  auto delta = BinaryDeltaBuilder(true)
+                   .startupCode("pre", "post")
+                   .deleted({})
+                   .modules({{0, "0"}})
+                   .data();
+
+  EXPECT_TRUE(JSDeltaBundleClient::isBinaryDelta(delta.data(), delta.size()));
+  EXPECT_FALSE(JSDeltaBundleClient::isBinaryDelta("{}", 2));
+
+  ASSERT_THROW(client.patch("{}", 2), std::invalid_argument);
+  ASSERT_THROW(
+      client.patch(delta.data(), delta.size() - 1), std::invalid_argument);
+  ASSERT_THROW(
+      client.patch((delta + "x").data(), delta.size() + 1),
+      std::invalid_argument);
+
+  auto oversized = BinaryDeltaBuilder(false).deleted({}).modules({}).data();
+  oversized.replace(oversized.size() - 4, 4, 4, '\xFF');
+  ASSERT_THROW(
+      client.patch(oversized.data(), oversized.size()), std::invalid_argument);
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModule.h>
+#include <folly/dynamic.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class FakeModule : public NativeModule {
+ public:
+  FakeModule(
+      std::string name,
+      std::vector<MethodDescriptor> methods,
+      folly::dynamic constants,
+      int &getConstantsCount)
+      : name_(std::move(name)),
+        methods_(std::move(methods)),
+        constants_(std::move(constants)),
+        getConstantsCount_(getConstantsCount) {}
+
+  std::string getName() override {
+    return name_;
+  }
+
+  std::vector<MethodDescriptor> getMethods() override {
+    return methods_;
+  }
+
+  folly::dynamic getConstants() override {
+    getConstantsCount_++;
+    return constants_;
+  }
+
+  void invoke(unsigned int, folly::dynamic &&, int) override {}
+
+  MethodCallResult callSerializableNativeHook(
+      unsigned int,
+      folly::dynamic &&) override {
+    return folly::none;
+  }
+
+ private:
+  std::string name_;
+  std::vector<MethodDescriptor> methods_;
+  folly::dynamic constants_;
+  int &getConstantsCount_;
+};
+
+std::unique_ptr<ModuleRegistry> createRegistry(int &getConstantsCount) {
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(std::make_unique<FakeModule>(
+      "RCTNetworking",
+      std::vector<MethodDescriptor>{
+          {"sendRequest", "async"},
+          {"clearCookies", "promise"},
+          {"getCookie", "sync"}},
+      folly::dynamic::object("version", 2),
+      getConstantsCount));
+  modules.push_back(std::make_unique<FakeModule>(
+      "PlatformConstants",
+      std::vector<MethodDescriptor>{},
+      folly::dynamic::object("isTesting", true),
+      getConstantsCount));
+  modules.push_back(std::make_unique<FakeModule>(
+      "Empty",
+      std::vector<MethodDescriptor>{},
+      folly::dynamic::object(),
+      getConstantsCount));
+  return std::make_unique<ModuleRegistry>(std::move(modules));
+}
+
+} // namespace
+
+TEST(ModuleRegistry, GetConfig) {
+  auto getConstantsCount = 0;
+  auto registry = createRegistry(getConstantsCount);
+
+  auto config = registry->getConfig("Networking");
+  ASSERT_TRUE(config.hasValue());
+  EXPECT_EQ(config->index, 0);
+  EXPECT_EQ(
+      config->config,
+      folly::dynamic::array(
+          "Networking",
+          folly::dynamic::object("version", 2),
+          folly::dynamic::array("sendRequest", "clearCookies", "getCookie"),
+          folly::dynamic::array(1),
+          folly::dynamic::array(2)));
+
+  config = registry->getConfig("PlatformConstants");
+  ASSERT_TRUE(config.hasValue());
+  EXPECT_EQ(config->index, 1);
+  EXPECT_EQ(config->config.size(), 2);
+
+  EXPECT_FALSE(registry->getConfig("Empty").hasValue());
+  EXPECT_FALSE(registry->getConfig("Unknown").hasValue());
+}
+
+TEST(ModuleRegistry, GetMethodsConfigDoesNotGenerateConstants) {
+  auto getConstantsCount = 0;
+  auto registry = createRegistry(getConstantsCount);
+
+  auto index = registry->getModuleIndex("Networking");
+  ASSERT_TRUE(index.hasValue());
+  EXPECT_EQ(
+      registry->getMethodsConfig(*index),
+      folly::dynamic::array(
+          folly::dynamic::array("sendRequest", "clearCookies", "getCookie"),
+          folly::dynamic::array(1),
+          folly::dynamic::array(2)));
+  EXPECT_EQ(getConstantsCount, 0);
+
+  EXPECT_EQ(
+      registry->getConstants(*index), folly::dynamic::object("version", 2));
+  EXPECT_EQ(getConstantsCount, 1);
+
+  index = registry->getModuleIndex("PlatformConstants");
+  ASSERT_TRUE(index.hasValue());
+  EXPECT_TRUE(registry->getMethodsConfig(*index).empty());
+
+  EXPECT_FALSE(registry->getModuleIndex("Unknown").hasValue());
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include <cxxreact/ReactMarkerTimeline.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+
+using namespace facebook::react;
+using namespace facebook::react::ReactMarker;
+
+namespace {
+
+ReactMarkerTimeline::Clock::time_point at(int milliseconds) {
+  return ReactMarkerTimeline::Clock::time_point{} +
+      std::chrono::milliseconds(milliseconds);
+}
+
+void logStartup(ReactMarkerTimeline &timeline) {
+  // Native modules are set up while the bundle is converted.
+  timeline.logMarker(JS_BUNDLE_STRING_CONVERT_START, nullptr, at(0));
+  timeline.logMarker(NATIVE_MODULE_SETUP_START, "UIManager", at(1));
+  timeline.logMarker(NATIVE_MODULE_SETUP_STOP, "UIManager", at(6));
+  timeline.logMarker(JS_BUNDLE_STRING_CONVERT_STOP, nullptr, at(10));
+
+  timeline.logMarker(RUN_JS_BUNDLE_START, "index.bundle", at(10));
+  timeline.logMarker(NATIVE_REQUIRE_START, "1", at(12));
+  timeline.logMarker(NATIVE_REQUIRE_START, "2", at(13));
+  timeline.logMarker(NATIVE_REQUIRE_STOP, "2", at(15));
+  timeline.logMarker(NATIVE_REQUIRE_STOP, "1", at(18));
+  timeline.logMarker(NATIVE_MODULE_SETUP_START, "Networking", at(19));
+  timeline.logMarker(NATIVE_MODULE_SETUP_STOP, "Networking", at(20));
+  timeline.logMarker(RUN_JS_BUNDLE_STOP, "index.bundle", at(40));
+
+  timeline.logMarker(CREATE_REACT_CONTEXT_STOP, nullptr, at(42));
+}
+
+} // namespace
+
+TEST(ReactMarkerTimeline, PairsMarkers) {
+  ReactMarkerTimeline timeline;
+  logStartup(timeline);
+
+  auto spans = timeline.getSpans();
+  ASSERT_EQ(spans.size(), 6);
+
+  EXPECT_EQ(spans[0].name, "JS_BUNDLE_STRING_CONVERT");
+  EXPECT_EQ(spans[0].tag, "");
+  EXPECT_EQ(spans[1].name, "NATIVE_MODULE_SETUP");
+  EXPECT_EQ(spans[1].tag, "UIManager");
+  EXPECT_EQ(spans[1].getDuration(), std::chrono::milliseconds(5));
+  EXPECT_EQ(spans[2].name, "RUN_JS_BUNDLE");
+  EXPECT_EQ(spans[3].tag, "1");
+  EXPECT_EQ(spans[3].getDuration(), std::chrono::milliseconds(6));
+  EXPECT_EQ(spans[4].tag, "2");
+  EXPECT_EQ(spans[4].getDuration(), std::chrono::milliseconds(2));
+  EXPECT_EQ(spans[5].tag, "Networking");
+}
+
+TEST(ReactMarkerTimeline, ComputesPhases) {
+  ReactMarkerTimeline timeline;
+  logStartup(timeline);
+
+  auto phases = timeline.getPhases();
+  ASSERT_EQ(phases.size(), 4);
+
+  EXPECT_EQ(phases[0].name, "RUN_JS_BUNDLE");
+  EXPECT_EQ(phases[0].totalDuration, std::chrono::milliseconds(30));
+  EXPECT_EQ(phases[1].name, "JS_BUNDLE_STRING_CONVERT");
+  EXPECT_EQ(phases[2].name, "NATIVE_REQUIRE");
+  EXPECT_EQ(phases[2].count, 2);
+  EXPECT_EQ(phases[2].totalDuration, std::chrono::milliseconds(8));
+  EXPECT_EQ(phases[2].maxDuration, std::chrono::milliseconds(6));
+  EXPECT_EQ(phases[3].name, "NATIVE_MODULE_SETUP");
+  EXPECT_EQ(phases[3].count, 2);
+  EXPECT_EQ(phases[3].totalDuration, std::chrono::milliseconds(6));
+}
+
+TEST(ReactMarkerTimeline, ComputesCriticalPath) {
+  ReactMarkerTimeline timeline;
+  logStartup(timeline);
+
+  auto criticalPath = timeline.getCriticalPath();
+  ASSERT_EQ(criticalPath.size(), 2);
+  EXPECT_EQ(criticalPath[0].name, "JS_BUNDLE_STRING_CONVERT");
+  EXPECT_EQ(criticalPath[1].name, "RUN_JS_BUNDLE");
+}
+
+TEST(ReactMarkerTimeline, ExportsChromeTrace) {
+  ReactMarkerTimeline timeline;
+  logStartup(timeline);
+
+  auto trace = folly::parseJson(timeline.getChromeTrace());
+  auto const &events = trace["traceEvents"];
+  ASSERT_EQ(events.size(), 7);
+
+  EXPECT_EQ(events[1]["name"], "NATIVE_MODULE_SETUP: UIManager");
+  EXPECT_EQ(events[1]["ph"], "X");
+  EXPECT_EQ(events[1]["ts"].asDouble(), 1000);
+  EXPECT_EQ(events[1]["dur"].asDouble(), 5000);
+
+  EXPECT_EQ(events[6]["name"], "CREATE_REACT_CONTEXT");
+  EXPECT_EQ(events[6]["ph"], "i");
+  EXPECT_EQ(events[6]["ts"].asDouble(), 42000);
+}
+
+TEST(ReactMarkerTimeline, IgnoresUnfinishedSpans) {
+  ReactMarkerTimeline timeline;
+  timeline.logMarker(RUN_JS_BUNDLE_START, nullptr, at(0));
+  timeline.logMarker(NATIVE_REQUIRE_START, "1", at(1));
+  timeline.logMarker(NATIVE_REQUIRE_STOP, "1", at(2));
+
+  EXPECT_EQ(timeline.getSpans().size(), 1);
+
+  timeline.clear();
+  EXPECT_TRUE(timeline.getSpans().empty());
+  EXPECT_TRUE(timeline.getCriticalPath().empty());
+}
+
+TEST(ReactMarkerTimeline, ComputesCriticalPathWithZeroLengthSpans) {
+  ReactMarkerTimeline timeline;
+  timeline.logMarker(NATIVE_MODULE_SETUP_START, "UIManager", at(0));
+  timeline.logMarker(NATIVE_MODULE_SETUP_STOP, "UIManager", at(5));
+  timeline.logMarker(NATIVE_REQUIRE_START, "1", at(5));
+  timeline.logMarker(NATIVE_REQUIRE_STOP, "1", at(5));
+  timeline.logMarker(NATIVE_REQUIRE_START, "2", at(8));
+  timeline.logMarker(NATIVE_REQUIRE_STOP, "2", at(8));
+
+  // "1" ends together with "UIManager", which starts earlier.
+  auto criticalPath = timeline.getCriticalPath();
+  ASSERT_EQ(criticalPath.size(), 2);
+  EXPECT_EQ(criticalPath[0].tag, "UIManager");
+  EXPECT_EQ(criticalPath[1].tag, "2");
+}
+
+TEST(ReactMarkerTimeline, ComputesCriticalPathWithEqualEndTimes) {
+  ReactMarkerTimeline timeline;
+  timeline.logMarker(RUN_JS_BUNDLE_START, "index.bundle", at(0));
+  timeline.logMarker(NATIVE_REQUIRE_START, "1", at(5));
+  timeline.logMarker(NATIVE_REQUIRE_STOP, "1", at(10));
+  timeline.logMarker(RUN_JS_BUNDLE_STOP, "index.bundle", at(10));
+  timeline.logMarker(NATIVE_MODULE_SETUP_START, "Networking", at(10));
+  timeline.logMarker(NATIVE_MODULE_SETUP_STOP, "Networking", at(12));
+
+  // Of the spans which end at the same time, the outermost one is on the path.
+  auto criticalPath = timeline.getCriticalPath();
+  ASSERT_EQ(criticalPath.size(), 2);
+  EXPECT_EQ(criticalPath[0].name, "RUN_JS_BUNDLE");
+  EXPECT_EQ(criticalPath[1].name, "NATIVE_MODULE_SETUP");
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <cxxreact/JSDeltaBundleClient.h>
+#include <folly/Conv.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Measures applying deltas of a synthetic bundle with 20k modules of 1KB
+ * (roughly a large dev bundle) in the JSON and in the binary format: a base
+ * delta (what every reload does) and a delta which modifies 1% of modules
+ * (what Fast Refresh does).
+ */
+
+static constexpr uint32_t kModuleCount = 20000;
+static constexpr size_t kModuleSize = 1000;
+
+static std::string moduleCode(uint32_t id, int revision) {
+  auto code = folly::to<std::string>(
+      "__d(function() { /* module ", id, " revision ", revision, " */ ");
+  code.resize(kModuleSize, ' ');
+  code += "});";
+  return code;
+}
+
+static bool isModified(uint32_t id, int revision) {
+  return revision == 0 || id % 100 == 0;
+}
+
+static std::string jsonDelta(int revision) {
+  auto modules = folly::dynamic::array();
+  for (uint32_t id = 0; id < kModuleCount; id++) {
+    if (isModified(id, revision)) {
+      modules.push_back(folly::dynamic::array(id, moduleCode(id, revision)));
+    }
+  }
+
+  auto delta = folly::dynamic::object("base", revision == 0)(
+      "revisionId", folly::to<std::string>(revision));
+  if (revision == 0) {
+    delta("pre", "var __DEV__ = true;")("post", "require(0);")(
+        "modules", modules);
+  } else {
+    delta("modified", modules);
+  }
+  return folly::toJson(delta);
+}
+
+static void appendUInt32(std::string &data, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    data.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+  }
+}
+
+static void appendString(std::string &data, const std::string &string) {
+  appendUInt32(data, string.size());
+  data += string;
+}
+
+static std::string binaryDelta(int revision) {
+  auto data = std::string{};
+  appendUInt32(data, JSDeltaBundleClient::kBinaryDeltaMagicNumber);
+  appendUInt32(data, revision == 0 ? 1 : 0);
+  if (revision == 0) {
+    appendString(data, "var __DEV__ = true;");
+    appendString(data, "require(0);");
+  }
+
+  // No deleted modules.
+  appendUInt32(data, 0);
+
+  auto modules = std::string{};
+  auto count = uint32_t{0};
+  for (uint32_t id = 0; id < kModuleCount; id++) {
+    if (isModified(id, revision)) {
+      appendUInt32(modules, id);
+      appendString(modules, moduleCode(id, revision));
+      count++;
+    }
+  }
+  appendUInt32(data, count);
+  data += modules;
+  return data;
+}
+
+static void patchBaseJSON(benchmark::State &state) {
+  auto delta = jsonDelta(0);
+  JSDeltaBundleClient client;
+
+  for (auto _ : state) {
+    client.patch(folly::parseJson(delta));
+  }
+  state.SetBytesProcessed(state.iterations() * delta.size());
+}
+BENCHMARK(patchBaseJSON)->Unit(benchmark::kMillisecond);
+
+static void patchBaseBinary(benchmark::State &state) {
+  auto delta = binaryDelta(0);
+  JSDeltaBundleClient client;
+
+  for (auto _ : state) {
+    client.patch(delta.data(), delta.size());
+  }
+  state.SetBytesProcessed(state.iterations() * delta.size());
+}
+BENCHMARK(patchBaseBinary)->Unit(benchmark::kMillisecond);
+
+static void patchModifiedJSON(benchmark::State &state) {
+  auto base = jsonDelta(0);
+  auto deltas = std::vector<std::string>{jsonDelta(1), jsonDelta(2)};
+  JSDeltaBundleClient client;
+  client.patch(folly::parseJson(base));
+
+  auto revision = size_t{0};
+  for (auto _ : state) {
+    client.patch(folly::parseJson(deltas[revision++ % deltas.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(patchModifiedJSON)->Unit(benchmark::kMicrosecond);
+
+static void patchModifiedBinary(benchmark::State &state) {
+  auto base = binaryDelta(0);
+  auto deltas = std::vector<std::string>{binaryDelta(1), binaryDelta(2)};
+  JSDeltaBundleClient client;
+  client.patch(base.data(), base.size());
+
+  auto revision = size_t{0};
+  for (auto _ : state) {
+    auto const &delta = deltas[revision++ % deltas.size()];
+    client.patch(delta.data(), delta.size());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(patchModifiedBinary)->Unit(benchmark::kMicrosecond);
+
+static void getStartupCode(benchmark::State &state) {
+  auto delta = binaryDelta(0);
+  JSDeltaBundleClient client;
+  client.patch(delta.data(), delta.size());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(client.getStartupCode());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(getStartupCode);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModule.h>
+#include <folly/Conv.h>
+#include <folly/dynamic.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Measures generating the configs of all modules of a registry with 150
+ * modules (10 methods and 50 constants each) during startup: eagerly (what
+ * `JSINativeModules` did for every required module) and lazily, when JS
+ * reads constants of only every tenth module.
+ */
+
+static constexpr int kModuleCount = 150;
+static constexpr int kMethodCount = 10;
+static constexpr int kConstantCount = 50;
+
+class BenchmarkModule : public NativeModule {
+ public:
+  explicit BenchmarkModule(int id) : id_(id) {}
+
+  std::string getName() override {
+    return folly::to<std::string>("Module", id_);
+  }
+
+  std::vector<MethodDescriptor> getMethods() override {
+    std::vector<MethodDescriptor> methods;
+    for (int i = 0; i < kMethodCount; i++) {
+      methods.emplace_back(
+          folly::to<std::string>("method", i), i % 3 ? "async" : "promise");
+    }
+    return methods;
+  }
+
+  folly::dynamic getConstants() override {
+    auto constants = folly::dynamic::object();
+    for (int i = 0; i < kConstantCount; i++) {
+      constants(
+          folly::to<std::string>("constant", i),
+          folly::dynamic::object("id", i)(
+              "value", folly::to<std::string>("Module", id_, ".", i)));
+    }
+    return constants;
+  }
+
+  void invoke(unsigned int, folly::dynamic &&, int) override {}
+
+  MethodCallResult callSerializableNativeHook(
+      unsigned int,
+      folly::dynamic &&) override {
+    return folly::none;
+  }
+
+ private:
+  int id_;
+};
+
+static std::unique_ptr<ModuleRegistry> createRegistry() {
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  for (int id = 0; id < kModuleCount; id++) {
+    modules.push_back(std::make_unique<BenchmarkModule>(id));
+  }
+  return std::make_unique<ModuleRegistry>(std::move(modules));
+}
+
+static std::vector<std::string> moduleNames() {
+  std::vector<std::string> names;
+  for (int id = 0; id < kModuleCount; id++) {
+    names.push_back(folly::to<std::string>("Module", id));
+  }
+  return names;
+}
+
+static void getConfigEagerly(benchmark::State &state) {
+  auto names = moduleNames();
+
+  for (auto _ : state) {
+    auto registry = createRegistry();
+    for (auto const &name : names) {
+      benchmark::DoNotOptimize(registry->getConfig(name));
+    }
+  }
+}
+BENCHMARK(getConfigEagerly)->Unit(benchmark::kMillisecond);
+
+static void getConfigLazily(benchmark::State &state) {
+  auto names = moduleNames();
+
+  for (auto _ : state) {
+    auto registry = createRegistry();
+    for (auto const &name : names) {
+      auto index = registry->getModuleIndex(name);
+      benchmark::DoNotOptimize(registry->getMethodsConfig(*index));
+      if (*index % 10 == 0) {
+        benchmark::DoNotOptimize(registry->getConstants(*index));
+      }
+    }
+  }
+}
+BENCHMARK(getConfigLazily)->Unit(benchmark::kMillisecond);
+
+} // namespace react
+} // namespace facebook
@@ -44,6 +44,42 @@ bool Fragment::operator!=(const Fragment &rhs) const {
 
 #pragma mark - AttributedString
 
+AttributedString::AttributedString(AttributedString const &other)
+    : Sealable(other),
+      DebugStringConvertible(other),
+      fragments_(other.fragments_),
+      hash_(other.hash_.load()),
+      layoutHash_(other.layoutHash_.load()) {}
+
+AttributedString::AttributedString(AttributedString &&other) noexcept
+    : Sealable(std::move(other)),
+      DebugStringConvertible(std::move(other)),
+      fragments_(std::move(other.fragments_)),
+      hash_(other.hash_.load()),
+      layoutHash_(other.layoutHash_.load()) {
+  other.invalidateHashes();
+}
+
+AttributedString &AttributedString::operator=(AttributedString const &other) {
+  Sealable::operator=(other);
+  DebugStringConvertible::operator=(other);
+  fragments_ = other.fragments_;
+  hash_ = other.hash_.load();
+  layoutHash_ = other.layoutHash_.load();
+  return *this;
+}
+
+AttributedString &AttributedString::operator=(
+    AttributedString &&other) noexcept {
+  Sealable::operator=(std::move(other));
+  DebugStringConvertible::operator=(std::move(other));
+  fragments_ = std::move(other.fragments_);
+  hash_ = other.hash_.load();
+  layoutHash_ = other.layoutHash_.load();
+  other.invalidateHashes();
+  return *this;
+}
+
 void AttributedString::appendFragment(const Fragment &fragment) {
   ensureUnsealed();
 
@@ -52,6 +88,7 @@ void AttributedString::appendFragment(const Fragment &fragment) {
   }
 
   fragments_.push_back(fragment);
+  invalidateHashes();
 }
 
 void AttributedString::prependFragment(const Fragment &fragment) {
@@ -62,6 +99,7 @@ void AttributedString::prependFragment(const Fragment &fragment) {
   }
 
   fragments_.insert(fragments_.begin(), fragment);
+  invalidateHashes();
 }
 
 void AttributedString::appendAttributedString(
@@ -71,6 +109,7 @@ void AttributedString::appendAttributedString(
       fragments_.end(),
       attributedString.fragments_.begin(),
       attributedString.fragments_.end());
+  invalidateHashes();
 }
 
 void AttributedString::prependAttributedString(
@@ -80,6 +119,7 @@ void AttributedString::prependAttributedString(
       fragments_.begin(),
       attributedString.fragments_.begin(),
       attributedString.fragments_.end());
+  invalidateHashes();
 }
 
 Fragments const &AttributedString::getFragments() const {
@@ -87,6 +127,9 @@ Fragments const &AttributedString::getFragments() const {
 }
 
 Fragments &AttributedString::getFragments() {
+  // The caller might mutate the fragments, so the hashes computed so far
+  // cannot be trusted anymore.
+  invalidateHashes();
   return fragments_;
 }
 
@@ -118,7 +161,51 @@ bool AttributedString::compareTextAttributesWithoutFrame(
   return true;
 }
 
+size_t AttributedString::getHash() const {
+  auto hash = hash_.load(std::memory_order_relaxed);
+  if (hash != 0) {
+    return hash;
+  }
+
+  hash = 0;
+  for (auto const &fragment : fragments_) {
+    hash = folly::hash::hash_combine(hash, fragment);
+  }
+
+  // `0` is reserved for "not computed yet".
+  hash = hash != 0 ? hash : 1;
+  hash_.store(hash, std::memory_order_relaxed);
+  return hash;
+}
+
+size_t AttributedString::getLayoutHash() const {
+  auto hash = layoutHash_.load(std::memory_order_relaxed);
+  if (hash != 0) {
+    return hash;
+  }
+
+  hash = 0;
+  for (auto const &fragment : fragments_) {
+    hash = folly::hash::hash_combine(
+        hash, textAttributesHashLayoutWise(fragment));
+  }
+
+  // `0` is reserved for "not computed yet".
+  hash = hash != 0 ? hash : 1;
+  layoutHash_.store(hash, std::memory_order_relaxed);
+  return hash;
+}
+
+void AttributedString::invalidateHashes() {
+  hash_.store(0, std::memory_order_relaxed);
+  layoutHash_.store(0, std::memory_order_relaxed);
+}
+
 bool AttributedString::operator==(const AttributedString &rhs) const {
+  if (this == &rhs) {
+    return true;
+  }
+
   return fragments_ == rhs.fragments_;
 }
 
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 
@@ -17,6 +18,7 @@
 #include <react/core/ShadowNode.h>
 #include <react/debug/DebugStringConvertible.h>
 #include <react/mounting/ShadowView.h>
+#include <react/utils/FloatComparison.h>
 
 namespace facebook {
 namespace react {
@@ -59,6 +61,12 @@ class AttributedString : public Sealable, public DebugStringConvertible {
 
   using Fragments = better::small_vector<Fragment, 1>;
 
+  AttributedString() = default;
+  AttributedString(AttributedString const &other);
+  AttributedString(AttributedString &&other) noexcept;
+  AttributedString &operator=(AttributedString const &other);
+  AttributedString &operator=(AttributedString &&other) noexcept;
+
   /*
    * Appends and prepends a `fragment` to the string.
    */
@@ -79,6 +87,8 @@ class AttributedString : public Sealable, public DebugStringConvertible {
 
   /*
    * Returns a reference to a list of fragments.
+   * The reference must not be used to mutate the fragments after `getHash`
+   * or `getLayoutHash` is called.
    */
   Fragments &getFragments();
 
@@ -97,6 +107,17 @@ class AttributedString : public Sealable, public DebugStringConvertible {
    */
   bool compareTextAttributesWithoutFrame(const AttributedString &rhs) const;
 
+  /*
+   * Returns the hash of all fragments (the same as `std::hash`) and
+   * the hash of all fragments that respects only what affects layout (see
+   * `areAttributedStringsEquivalentLayoutWise`).
+   * Both are computed on the first call and cached until the string is
+   * mutated, so repeated lookups of the same string in hash tables (like
+   * `TextMeasureCache`) are cheap. Can be called from any thread.
+   */
+  size_t getHash() const;
+  size_t getLayoutHash() const;
+
   bool operator==(const AttributedString &rhs) const;
   bool operator!=(const AttributedString &rhs) const;
 
@@ -107,9 +128,121 @@ class AttributedString : public Sealable, public DebugStringConvertible {
 #endif
 
  private:
+  void invalidateHashes();
+
   Fragments fragments_;
+
+  /*
+   * Cached hashes; `0` means that a hash is not computed yet.
+   */
+  mutable std::atomic<size_t> hash_{0};
+  mutable std::atomic<size_t> layoutHash_{0};
 };
 
+inline bool areTextAttributesEquivalentLayoutWise(
+    TextAttributes const &lhs,
+    TextAttributes const &rhs) {
+  // Here we check all attributes that affect layout metrics and don't check any
+  // attributes that affect only a decorative aspect of displayed text (like
+  // colors).
+  return std::tie(
+             lhs.fontFamily,
+             lhs.fontWeight,
+             lhs.fontStyle,
+             lhs.fontVariant,
+             lhs.allowFontScaling,
+             lhs.alignment) ==
+      std::tie(
+             rhs.fontFamily,
+             rhs.fontWeight,
+             rhs.fontStyle,
+             rhs.fontVariant,
+             rhs.allowFontScaling,
+             rhs.alignment) &&
+      floatEquality(lhs.fontSize, rhs.fontSize) &&
+      floatEquality(lhs.fontSizeMultiplier, rhs.fontSizeMultiplier) &&
+      floatEquality(lhs.letterSpacing, rhs.letterSpacing) &&
+      floatEquality(lhs.lineHeight, rhs.lineHeight);
+}
+
+inline size_t textAttributesHashLayoutWise(
+    TextAttributes const &textAttributes) {
+  // Taking into account the same props as
+  // `areTextAttributesEquivalentLayoutWise` mentions.
+  return folly::hash::hash_combine(
+      0,
+      textAttributes.fontFamily,
+      textAttributes.fontSize,
+      textAttributes.fontSizeMultiplier,
+      textAttributes.fontWeight,
+      textAttributes.fontStyle,
+      textAttributes.fontVariant,
+      textAttributes.allowFontScaling,
+      textAttributes.letterSpacing,
+      textAttributes.lineHeight,
+      textAttributes.alignment);
+}
+
+inline bool areAttributedStringFragmentsEquivalentLayoutWise(
+    AttributedString::Fragment const &lhs,
+    AttributedString::Fragment const &rhs) {
+  return lhs.string == rhs.string &&
+      areTextAttributesEquivalentLayoutWise(
+             lhs.textAttributes, rhs.textAttributes) &&
+      // LayoutMetrics of an attachment fragment affects the size of a measured
+      // attributed string.
+      (!lhs.isAttachment() ||
+       (lhs.parentShadowView.layoutMetrics ==
+        rhs.parentShadowView.layoutMetrics));
+}
+
+inline size_t textAttributesHashLayoutWise(
+    AttributedString::Fragment const &fragment) {
+  // Here we are not taking `isAttachment` and `layoutMetrics` into account
+  // because they are logically interdependent and this can break an invariant
+  // between hash and equivalence functions (and cause cache misses).
+  return folly::hash::hash_combine(
+      0,
+      fragment.string,
+      textAttributesHashLayoutWise(fragment.textAttributes));
+}
+
+inline bool areAttributedStringsEquivalentLayoutWise(
+    AttributedString const &lhs,
+    AttributedString const &rhs) {
+  if (&lhs == &rhs) {
+    return true;
+  }
+
+  // Hash tables only compare strings with equal hashes, so for them this
+  // never rejects strings that the full comparison would accept.
+  if (lhs.getLayoutHash() != rhs.getLayoutHash()) {
+    return false;
+  }
+
+  auto &lhsFragment = lhs.getFragments();
+  auto &rhsFragment = rhs.getFragments();
+
+  if (lhsFragment.size() != rhsFragment.size()) {
+    return false;
+  }
+
+  auto size = lhsFragment.size();
+  for (auto i = size_t{0}; i < size; i++) {
+    if (!areAttributedStringFragmentsEquivalentLayoutWise(
+            lhsFragment.at(i), rhsFragment.at(i))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+inline size_t textAttributedStringHashLayoutWise(
+    AttributedString const &attributedString) {
+  return attributedString.getLayoutHash();
+}
+
 } // namespace react
 } // namespace facebook
 
@@ -127,13 +260,7 @@ template <>
 struct hash<facebook::react::AttributedString> {
   size_t operator()(
       const facebook::react::AttributedString &attributedString) const {
-    auto seed = size_t{0};
-
-    for (const auto &fragment : attributedString.getFragments()) {
-      seed = folly::hash::hash_combine(seed, fragment);
-    }
-
-    return seed;
+    return attributedString.getHash();
   }
 };
 } // namespace std
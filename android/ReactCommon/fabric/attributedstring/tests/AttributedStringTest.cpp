@@ -9,6 +9,7 @@
 
 #include <assert.h>
 #include <gtest/gtest.h>
+#include <react/attributedstring/AttributedString.h>
 #include <react/attributedstring/TextAttributes.h>
 #include <react/attributedstring/conversions.h>
 #include <react/attributedstring/primitives.h>
@@ -46,5 +47,73 @@ TEST(AttributedStringTest, testToDynamic) {
 
 #endif
 
+static AttributedString::Fragment makeFragment(
+    std::string const &string,
+    Float fontSize) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = string;
+  fragment.textAttributes.fontSize = fontSize;
+  return fragment;
+}
+
+TEST(AttributedStringTest, testHashIsCachedUntilMutation) {
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("Hello", 12));
+
+  auto hash = attributedString.getHash();
+  auto layoutHash = attributedString.getLayoutHash();
+  EXPECT_EQ(attributedString.getHash(), hash);
+  EXPECT_EQ(std::hash<AttributedString>{}(attributedString), hash);
+  EXPECT_EQ(attributedString.getLayoutHash(), layoutHash);
+
+  attributedString.appendFragment(makeFragment(", World", 12));
+  EXPECT_NE(attributedString.getHash(), hash);
+  EXPECT_NE(attributedString.getLayoutHash(), layoutHash);
+
+  auto sameAttributedString = AttributedString{};
+  sameAttributedString.appendFragment(makeFragment("Hello", 12));
+  sameAttributedString.appendFragment(makeFragment(", World", 12));
+  EXPECT_EQ(attributedString.getHash(), sameAttributedString.getHash());
+  EXPECT_EQ(
+      attributedString.getLayoutHash(), sameAttributedString.getLayoutHash());
+}
+
+TEST(AttributedStringTest, testCopiesShareHash) {
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("Hello", 12));
+  auto hash = attributedString.getHash();
+
+  auto copy = attributedString;
+  EXPECT_EQ(copy.getHash(), hash);
+  EXPECT_EQ(copy, attributedString);
+
+  copy.getFragments()[0].string = "World";
+  EXPECT_NE(copy.getHash(), hash);
+  EXPECT_NE(copy, attributedString);
+  EXPECT_EQ(attributedString.getHash(), hash);
+}
+
+TEST(AttributedStringTest, testLayoutWiseEquivalence) {
+  auto lhs = AttributedString{};
+  lhs.appendFragment(makeFragment("Hello", 12));
+
+  auto fragment = makeFragment("Hello", 12);
+  fragment.textAttributes.foregroundColor = colorFromComponents({1, 0, 0, 1});
+  auto rhs = AttributedString{};
+  rhs.appendFragment(fragment);
+
+  EXPECT_NE(lhs, rhs);
+  EXPECT_TRUE(areAttributedStringsEquivalentLayoutWise(lhs, rhs));
+  EXPECT_EQ(
+      textAttributedStringHashLayoutWise(lhs),
+      textAttributedStringHashLayoutWise(rhs));
+
+  auto largerFragment = makeFragment("Hello", 14);
+  auto larger = AttributedString{};
+  larger.appendFragment(largerFragment);
+
+  EXPECT_FALSE(areAttributedStringsEquivalentLayoutWise(lhs, larger));
+}
+
 } // namespace react
 } // namespace facebook
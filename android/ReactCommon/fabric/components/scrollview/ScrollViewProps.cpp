@@ -11,136 +11,95 @@
 #include <react/debug/debugStringConvertibleUtils.h>
 #include <react/graphics/conversions.h>
 
+#include <react/core/RawPropsFieldTable.h>
 #include <react/core/propsConversions.h>
 
 namespace facebook {
 namespace react {
 
+static RawPropsFieldTable<ScrollViewProps> const &scrollViewPropsFieldTable() {
+  using Table = RawPropsFieldTable<ScrollViewProps>;
+  static auto const table = Table{
+      Table::field<bool, &ScrollViewProps::alwaysBounceHorizontal>(
+          "alwaysBounceHorizontal"),
+      Table::field<bool, &ScrollViewProps::alwaysBounceVertical>(
+          "alwaysBounceVertical"),
+      Table::field<bool, &ScrollViewProps::bounces>("bounces"),
+      Table::field<bool, &ScrollViewProps::bouncesZoom>("bouncesZoom"),
+      Table::field<bool, &ScrollViewProps::canCancelContentTouches>(
+          "canCancelContentTouches"),
+      Table::field<bool, &ScrollViewProps::centerContent>("centerContent"),
+      Table::field<bool, &ScrollViewProps::automaticallyAdjustContentInsets>(
+          "automaticallyAdjustContentInsets"),
+      Table::field<Float, &ScrollViewProps::decelerationRate>(
+          "decelerationRate"),
+      Table::field<bool, &ScrollViewProps::directionalLockEnabled>(
+          "directionalLockEnabled"),
+      Table::field<ScrollViewIndicatorStyle, &ScrollViewProps::indicatorStyle>(
+          "indicatorStyle"),
+      Table::field<
+          ScrollViewKeyboardDismissMode,
+          &ScrollViewProps::keyboardDismissMode>("keyboardDismissMode"),
+      Table::field<Float, &ScrollViewProps::maximumZoomScale>(
+          "maximumZoomScale"),
+      Table::field<Float, &ScrollViewProps::minimumZoomScale>(
+          "minimumZoomScale"),
+      Table::field<bool, &ScrollViewProps::scrollEnabled>("scrollEnabled"),
+      Table::field<bool, &ScrollViewProps::pagingEnabled>("pagingEnabled"),
+      Table::field<bool, &ScrollViewProps::pinchGestureEnabled>(
+          "pinchGestureEnabled"),
+      Table::field<bool, &ScrollViewProps::scrollsToTop>("scrollsToTop"),
+      Table::field<bool, &ScrollViewProps::showsHorizontalScrollIndicator>(
+          "showsHorizontalScrollIndicator"),
+      Table::field<bool, &ScrollViewProps::showsVerticalScrollIndicator>(
+          "showsVerticalScrollIndicator"),
+      Table::field<Float, &ScrollViewProps::scrollEventThrottle>(
+          "scrollEventThrottle"),
+      Table::field<Float, &ScrollViewProps::zoomScale>("zoomScale"),
+      Table::field<EdgeInsets, &ScrollViewProps::contentInset>("contentInset"),
+      Table::field<EdgeInsets, &ScrollViewProps::scrollIndicatorInsets>(
+          "scrollIndicatorInsets"),
+      Table::field<Float, &ScrollViewProps::snapToInterval>("snapToInterval"),
+      Table::field<
+          ScrollViewSnapToAlignment,
+          &ScrollViewProps::snapToAlignment>("snapToAlignment"),
+  };
+  return table;
+}
+
 ScrollViewProps::ScrollViewProps(
     const ScrollViewProps &sourceProps,
     const RawProps &rawProps)
     : ViewProps(sourceProps, rawProps),
-      alwaysBounceHorizontal(convertRawProp(
-          rawProps,
-          "alwaysBounceHorizontal",
-          sourceProps.alwaysBounceHorizontal,
-          {})),
-      alwaysBounceVertical(convertRawProp(
-          rawProps,
-          "alwaysBounceVertical",
-          sourceProps.alwaysBounceVertical,
-          {})),
-      bounces(convertRawProp(rawProps, "bounces", sourceProps.bounces, true)),
-      bouncesZoom(convertRawProp(
-          rawProps,
-          "bouncesZoom",
-          sourceProps.bouncesZoom,
-          true)),
-      canCancelContentTouches(convertRawProp(
-          rawProps,
-          "canCancelContentTouches",
-          sourceProps.canCancelContentTouches,
-          true)),
-      centerContent(convertRawProp(
-          rawProps,
-          "centerContent",
-          sourceProps.centerContent,
-          {})),
-      automaticallyAdjustContentInsets(convertRawProp(
-          rawProps,
-          "automaticallyAdjustContentInsets",
-          sourceProps.automaticallyAdjustContentInsets,
-          {})),
-      decelerationRate(convertRawProp(
-          rawProps,
-          "decelerationRate",
-          sourceProps.decelerationRate,
-          (Float)0.998)),
-      directionalLockEnabled(convertRawProp(
-          rawProps,
-          "directionalLockEnabled",
-          sourceProps.directionalLockEnabled,
-          {})),
-      indicatorStyle(convertRawProp(
-          rawProps,
-          "indicatorStyle",
-          sourceProps.indicatorStyle,
-          {})),
-      keyboardDismissMode(convertRawProp(
-          rawProps,
-          "keyboardDismissMode",
-          sourceProps.keyboardDismissMode,
-          {})),
-      maximumZoomScale(convertRawProp(
-          rawProps,
-          "maximumZoomScale",
-          sourceProps.maximumZoomScale,
-          (Float)1.0)),
-      minimumZoomScale(convertRawProp(
-          rawProps,
-          "minimumZoomScale",
-          sourceProps.minimumZoomScale,
-          (Float)1.0)),
-      scrollEnabled(convertRawProp(
-          rawProps,
-          "scrollEnabled",
-          sourceProps.scrollEnabled,
-          true)),
-      pagingEnabled(convertRawProp(
-          rawProps,
-          "pagingEnabled",
-          sourceProps.pagingEnabled,
-          {})),
-      pinchGestureEnabled(convertRawProp(
-          rawProps,
-          "pinchGestureEnabled",
-          sourceProps.pinchGestureEnabled,
-          true)),
-      scrollsToTop(convertRawProp(
-          rawProps,
-          "scrollsToTop",
-          sourceProps.scrollsToTop,
-          true)),
-      showsHorizontalScrollIndicator(convertRawProp(
-          rawProps,
-          "showsHorizontalScrollIndicator",
-          sourceProps.showsHorizontalScrollIndicator,
-          true)),
-      showsVerticalScrollIndicator(convertRawProp(
-          rawProps,
-          "showsVerticalScrollIndicator",
-          sourceProps.showsVerticalScrollIndicator,
-          true)),
-      scrollEventThrottle(convertRawProp(
-          rawProps,
-          "scrollEventThrottle",
-          sourceProps.scrollEventThrottle,
-          {})),
-      zoomScale(convertRawProp(
-          rawProps,
-          "zoomScale",
-          sourceProps.zoomScale,
-          (Float)1.0)),
-      contentInset(convertRawProp(
-          rawProps,
-          "contentInset",
-          sourceProps.contentInset,
-          {})),
-      scrollIndicatorInsets(convertRawProp(
-          rawProps,
-          "scrollIndicatorInsets",
-          sourceProps.scrollIndicatorInsets,
-          {})),
-      snapToInterval(convertRawProp(
-          rawProps,
-          "snapToInterval",
-          sourceProps.snapToInterval,
-          {})),
-      snapToAlignment(convertRawProp(
-          rawProps,
-          "snapToAlignment",
-          sourceProps.snapToAlignment,
-          {})) {}
+      alwaysBounceHorizontal(sourceProps.alwaysBounceHorizontal),
+      alwaysBounceVertical(sourceProps.alwaysBounceVertical),
+      bounces(sourceProps.bounces),
+      bouncesZoom(sourceProps.bouncesZoom),
+      canCancelContentTouches(sourceProps.canCancelContentTouches),
+      centerContent(sourceProps.centerContent),
+      automaticallyAdjustContentInsets(
+          sourceProps.automaticallyAdjustContentInsets),
+      decelerationRate(sourceProps.decelerationRate),
+      directionalLockEnabled(sourceProps.directionalLockEnabled),
+      indicatorStyle(sourceProps.indicatorStyle),
+      keyboardDismissMode(sourceProps.keyboardDismissMode),
+      maximumZoomScale(sourceProps.maximumZoomScale),
+      minimumZoomScale(sourceProps.minimumZoomScale),
+      scrollEnabled(sourceProps.scrollEnabled),
+      pagingEnabled(sourceProps.pagingEnabled),
+      pinchGestureEnabled(sourceProps.pinchGestureEnabled),
+      scrollsToTop(sourceProps.scrollsToTop),
+      showsHorizontalScrollIndicator(
+          sourceProps.showsHorizontalScrollIndicator),
+      showsVerticalScrollIndicator(sourceProps.showsVerticalScrollIndicator),
+      scrollEventThrottle(sourceProps.scrollEventThrottle),
+      zoomScale(sourceProps.zoomScale),
+      contentInset(sourceProps.contentInset),
+      scrollIndicatorInsets(sourceProps.scrollIndicatorInsets),
+      snapToInterval(sourceProps.snapToInterval),
+      snapToAlignment(sourceProps.snapToAlignment) {
+  scrollViewPropsFieldTable().apply(*this, rawProps);
+}
 
 #pragma mark - DebugStringConvertible
 
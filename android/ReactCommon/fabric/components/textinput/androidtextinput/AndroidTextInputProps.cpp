@@ -7,6 +7,7 @@
 
 #include "AndroidTextInputProps.h"
 #include <react/components/image/conversions.h>
+#include <react/core/RawPropsFieldTable.h>
 #include <react/core/propsConversions.h>
 #include <react/graphics/conversions.h>
 
@@ -36,216 +37,134 @@ static bool hasValue(
   return false;
 }
 
+static RawPropsFieldTable<AndroidTextInputProps> const &
+androidTextInputPropsFieldTable() {
+  using Table = RawPropsFieldTable<AndroidTextInputProps>;
+  // Props that `BaseTextProps` requests first (`color`, `fontSize` and the
+  // like) are left out: the base class is the one that gets their values, the
+  // members of the same names here keep their default values.
+  static auto const table = Table{
+      Table::field<std::string, &AndroidTextInputProps::autoCompleteType>(
+          "autoCompleteType"),
+      Table::field<std::string, &AndroidTextInputProps::returnKeyLabel>(
+          "returnKeyLabel"),
+      Table::field<int, &AndroidTextInputProps::numberOfLines>("numberOfLines"),
+      Table::field<bool, &AndroidTextInputProps::disableFullscreenUI>(
+          "disableFullscreenUI"),
+      Table::field<std::string, &AndroidTextInputProps::textBreakStrategy>(
+          "textBreakStrategy"),
+      Table::field<SharedColor, &AndroidTextInputProps::underlineColorAndroid>(
+          "underlineColorAndroid"),
+      Table::field<std::string, &AndroidTextInputProps::inlineImageLeft>(
+          "inlineImageLeft"),
+      Table::field<int, &AndroidTextInputProps::inlineImagePadding>(
+          "inlineImagePadding"),
+      Table::field<std::string, &AndroidTextInputProps::importantForAutofill>(
+          "importantForAutofill"),
+      Table::field<bool, &AndroidTextInputProps::showSoftInputOnFocus>(
+          "showSoftInputOnFocus"),
+      Table::field<std::string, &AndroidTextInputProps::autoCapitalize>(
+          "autoCapitalize"),
+      Table::field<bool, &AndroidTextInputProps::autoCorrect>("autoCorrect"),
+      Table::field<bool, &AndroidTextInputProps::autoFocus>("autoFocus"),
+      Table::field<Float, &AndroidTextInputProps::maxFontSizeMultiplier>(
+          "maxFontSizeMultiplier"),
+      Table::field<bool, &AndroidTextInputProps::editable>("editable"),
+      Table::field<std::string, &AndroidTextInputProps::keyboardType>(
+          "keyboardType"),
+      Table::field<std::string, &AndroidTextInputProps::returnKeyType>(
+          "returnKeyType"),
+      Table::field<int, &AndroidTextInputProps::maxLength>("maxLength"),
+      Table::field<bool, &AndroidTextInputProps::multiline>("multiline"),
+      Table::field<std::string, &AndroidTextInputProps::placeholder>(
+          "placeholder"),
+      Table::field<SharedColor, &AndroidTextInputProps::placeholderTextColor>(
+          "placeholderTextColor"),
+      Table::field<bool, &AndroidTextInputProps::secureTextEntry>(
+          "secureTextEntry"),
+      Table::field<SharedColor, &AndroidTextInputProps::selectionColor>(
+          "selectionColor"),
+      Table::field<
+          AndroidTextInputSelectionStruct,
+          &AndroidTextInputProps::selection>("selection"),
+      Table::field<std::string, &AndroidTextInputProps::value>("value"),
+      Table::field<std::string, &AndroidTextInputProps::defaultValue>(
+          "defaultValue"),
+      Table::field<bool, &AndroidTextInputProps::selectTextOnFocus>(
+          "selectTextOnFocus"),
+      Table::field<bool, &AndroidTextInputProps::blurOnSubmit>("blurOnSubmit"),
+      Table::field<bool, &AndroidTextInputProps::caretHidden>("caretHidden"),
+      Table::field<bool, &AndroidTextInputProps::contextMenuHidden>(
+          "contextMenuHidden"),
+      Table::field<std::string, &AndroidTextInputProps::textTransform>(
+          "textTransform"),
+      Table::field<bool, &AndroidTextInputProps::includeFontPadding>(
+          "includeFontPadding"),
+      Table::field<std::string, &AndroidTextInputProps::textAlignVertical>(
+          "textAlignVertical"),
+      Table::field<SharedColor, &AndroidTextInputProps::cursorColor>(
+          "cursorColor"),
+      Table::field<int, &AndroidTextInputProps::mostRecentEventCount>(
+          "mostRecentEventCount"),
+      Table::field<std::string, &AndroidTextInputProps::text>("text"),
+  };
+  return table;
+}
+
 AndroidTextInputProps::AndroidTextInputProps(
     const AndroidTextInputProps &sourceProps,
     const RawProps &rawProps)
     : ViewProps(sourceProps, rawProps),
       BaseTextProps(sourceProps, rawProps),
-      autoCompleteType(convertRawProp(
-          rawProps,
-          "autoCompleteType",
-          sourceProps.autoCompleteType,
-          {})),
-      returnKeyLabel(convertRawProp(
-          rawProps,
-          "returnKeyLabel",
-          sourceProps.returnKeyLabel,
-          {})),
-      numberOfLines(convertRawProp(
-          rawProps,
-          "numberOfLines",
-          sourceProps.numberOfLines,
-          {0})),
-      disableFullscreenUI(convertRawProp(
-          rawProps,
-          "disableFullscreenUI",
-          sourceProps.disableFullscreenUI,
-          {false})),
-      textBreakStrategy(convertRawProp(
-          rawProps,
-          "textBreakStrategy",
-          sourceProps.textBreakStrategy,
-          {})),
-      underlineColorAndroid(convertRawProp(
-          rawProps,
-          "underlineColorAndroid",
-          sourceProps.underlineColorAndroid,
-          {})),
-      inlineImageLeft(convertRawProp(
-          rawProps,
-          "inlineImageLeft",
-          sourceProps.inlineImageLeft,
-          {})),
-      inlineImagePadding(convertRawProp(
-          rawProps,
-          "inlineImagePadding",
-          sourceProps.inlineImagePadding,
-          {0})),
-      importantForAutofill(convertRawProp(
-          rawProps,
-          "importantForAutofill",
-          sourceProps.importantForAutofill,
-          {})),
-      showSoftInputOnFocus(convertRawProp(
-          rawProps,
-          "showSoftInputOnFocus",
-          sourceProps.showSoftInputOnFocus,
-          {false})),
-      autoCapitalize(convertRawProp(
-          rawProps,
-          "autoCapitalize",
-          sourceProps.autoCapitalize,
-          {})),
-      autoCorrect(convertRawProp(
-          rawProps,
-          "autoCorrect",
-          sourceProps.autoCorrect,
-          {false})),
-      autoFocus(convertRawProp(
-          rawProps,
-          "autoFocus",
-          sourceProps.autoFocus,
-          {false})),
-      allowFontScaling(convertRawProp(
-          rawProps,
-          "allowFontScaling",
-          sourceProps.allowFontScaling,
-          {false})),
-      maxFontSizeMultiplier(convertRawProp(
-          rawProps,
-          "maxFontSizeMultiplier",
-          sourceProps.maxFontSizeMultiplier,
-          {0.0})),
-      editable(
-          convertRawProp(rawProps, "editable", sourceProps.editable, {false})),
-      keyboardType(convertRawProp(
-          rawProps,
-          "keyboardType",
-          sourceProps.keyboardType,
-          {})),
-      returnKeyType(convertRawProp(
-          rawProps,
-          "returnKeyType",
-          sourceProps.returnKeyType,
-          {})),
-      maxLength(
-          convertRawProp(rawProps, "maxLength", sourceProps.maxLength, {0})),
-      multiline(convertRawProp(
-          rawProps,
-          "multiline",
-          sourceProps.multiline,
-          {false})),
-      placeholder(
-          convertRawProp(rawProps, "placeholder", sourceProps.placeholder, {})),
-      placeholderTextColor(convertRawProp(
-          rawProps,
-          "placeholderTextColor",
-          sourceProps.placeholderTextColor,
-          {})),
-      secureTextEntry(convertRawProp(
-          rawProps,
-          "secureTextEntry",
-          sourceProps.secureTextEntry,
-          {false})),
-      selectionColor(convertRawProp(
-          rawProps,
-          "selectionColor",
-          sourceProps.selectionColor,
-          {})),
-      selection(
-          convertRawProp(rawProps, "selection", sourceProps.selection, {})),
-      value(convertRawProp(rawProps, "value", sourceProps.value, {})),
-      defaultValue(convertRawProp(
-          rawProps,
-          "defaultValue",
-          sourceProps.defaultValue,
-          {})),
-      selectTextOnFocus(convertRawProp(
-          rawProps,
-          "selectTextOnFocus",
-          sourceProps.selectTextOnFocus,
-          {false})),
-      blurOnSubmit(convertRawProp(
-          rawProps,
-          "blurOnSubmit",
-          sourceProps.blurOnSubmit,
-          {false})),
-      caretHidden(convertRawProp(
-          rawProps,
-          "caretHidden",
-          sourceProps.caretHidden,
-          {false})),
-      contextMenuHidden(convertRawProp(
-          rawProps,
-          "contextMenuHidden",
-          sourceProps.contextMenuHidden,
-          {false})),
-      textShadowColor(convertRawProp(
-          rawProps,
-          "textShadowColor",
-          sourceProps.textShadowColor,
-          {})),
-      textShadowRadius(convertRawProp(
-          rawProps,
-          "textShadowRadius",
-          sourceProps.textShadowRadius,
-          {0.0})),
-      textDecorationLine(convertRawProp(
-          rawProps,
-          "textDecorationLine",
-          sourceProps.textDecorationLine,
-          {})),
-      fontStyle(
-          convertRawProp(rawProps, "fontStyle", sourceProps.fontStyle, {})),
-      textShadowOffset(convertRawProp(
-          rawProps,
-          "textShadowOffset",
-          sourceProps.textShadowOffset,
-          {})),
-      lineHeight(convertRawProp(
-          rawProps,
-          "lineHeight",
-          sourceProps.lineHeight,
-          {0.0})),
-      textTransform(convertRawProp(
-          rawProps,
-          "textTransform",
-          sourceProps.textTransform,
-          {})),
-      color(convertRawProp(rawProps, "color", sourceProps.color, {0})),
-      letterSpacing(convertRawProp(
-          rawProps,
-          "letterSpacing",
-          sourceProps.letterSpacing,
-          {0.0})),
-      fontSize(
-          convertRawProp(rawProps, "fontSize", sourceProps.fontSize, {0.0})),
-      textAlign(
-          convertRawProp(rawProps, "textAlign", sourceProps.textAlign, {})),
-      includeFontPadding(convertRawProp(
-          rawProps,
-          "includeFontPadding",
-          sourceProps.includeFontPadding,
-          {false})),
-      fontWeight(
-          convertRawProp(rawProps, "fontWeight", sourceProps.fontWeight, {})),
-      fontFamily(
-          convertRawProp(rawProps, "fontFamily", sourceProps.fontFamily, {})),
-      textAlignVertical(convertRawProp(
-          rawProps,
-          "textAlignVertical",
-          sourceProps.textAlignVertical,
-          {})),
-      cursorColor(
-          convertRawProp(rawProps, "cursorColor", sourceProps.cursorColor, {})),
-      mostRecentEventCount(convertRawProp(
-          rawProps,
-          "mostRecentEventCount",
-          sourceProps.mostRecentEventCount,
-          {0})),
-      text(convertRawProp(rawProps, "text", sourceProps.text, {})),
-      paragraphAttributes(
-          convertRawProp(rawProps, sourceProps.paragraphAttributes, {})),
+      autoCompleteType(sourceProps.autoCompleteType),
+      returnKeyLabel(sourceProps.returnKeyLabel),
+      numberOfLines(sourceProps.numberOfLines),
+      disableFullscreenUI(sourceProps.disableFullscreenUI),
+      textBreakStrategy(sourceProps.textBreakStrategy),
+      underlineColorAndroid(sourceProps.underlineColorAndroid),
+      inlineImageLeft(sourceProps.inlineImageLeft),
+      inlineImagePadding(sourceProps.inlineImagePadding),
+      importantForAutofill(sourceProps.importantForAutofill),
+      showSoftInputOnFocus(sourceProps.showSoftInputOnFocus),
+      autoCapitalize(sourceProps.autoCapitalize),
+      autoCorrect(sourceProps.autoCorrect),
+      autoFocus(sourceProps.autoFocus),
+      allowFontScaling(sourceProps.allowFontScaling),
+      maxFontSizeMultiplier(sourceProps.maxFontSizeMultiplier),
+      editable(sourceProps.editable),
+      keyboardType(sourceProps.keyboardType),
+      returnKeyType(sourceProps.returnKeyType),
+      maxLength(sourceProps.maxLength),
+      multiline(sourceProps.multiline),
+      placeholder(sourceProps.placeholder),
+      placeholderTextColor(sourceProps.placeholderTextColor),
+      secureTextEntry(sourceProps.secureTextEntry),
+      selectionColor(sourceProps.selectionColor),
+      selection(sourceProps.selection),
+      value(sourceProps.value),
+      defaultValue(sourceProps.defaultValue),
+      selectTextOnFocus(sourceProps.selectTextOnFocus),
+      blurOnSubmit(sourceProps.blurOnSubmit),
+      caretHidden(sourceProps.caretHidden),
+      contextMenuHidden(sourceProps.contextMenuHidden),
+      textShadowColor(sourceProps.textShadowColor),
+      textShadowRadius(sourceProps.textShadowRadius),
+      textDecorationLine(sourceProps.textDecorationLine),
+      fontStyle(sourceProps.fontStyle),
+      textShadowOffset(sourceProps.textShadowOffset),
+      lineHeight(sourceProps.lineHeight),
+      textTransform(sourceProps.textTransform),
+      color(sourceProps.color),
+      letterSpacing(sourceProps.letterSpacing),
+      fontSize(sourceProps.fontSize),
+      textAlign(sourceProps.textAlign),
+      includeFontPadding(sourceProps.includeFontPadding),
+      fontWeight(sourceProps.fontWeight),
+      fontFamily(sourceProps.fontFamily),
+      textAlignVertical(sourceProps.textAlignVertical),
+      cursorColor(sourceProps.cursorColor),
+      mostRecentEventCount(sourceProps.mostRecentEventCount),
+      text(sourceProps.text),
       // See AndroidTextInputComponentDescriptor for usage
       // TODO T63008435: can these, and this feature, be removed entirely?
       hasPadding(hasValue(rawProps, sourceProps.hasPadding, "", "padding", "")),
@@ -289,6 +208,12 @@ AndroidTextInputProps::AndroidTextInputProps(
           "")),
       hasPaddingEnd(
           hasValue(rawProps, sourceProps.hasPaddingEnd, "End", "padding", "")) {
+  androidTextInputPropsFieldTable().apply(*this, rawProps);
+
+  // Paragraph attributes share `numberOfLines` and `textBreakStrategy` with
+  // the table; the table has to request them first to get their values.
+  paragraphAttributes =
+      convertRawProp(rawProps, sourceProps.paragraphAttributes, {});
 }
 
 // TODO T53300085: support this in codegen; this was hand-written
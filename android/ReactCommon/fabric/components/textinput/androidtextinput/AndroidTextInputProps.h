@@ -28,6 +28,10 @@ namespace react {
 struct AndroidTextInputSelectionStruct {
   int start;
   int end;
+
+  bool operator==(AndroidTextInputSelectionStruct const &rhs) const {
+    return start == rhs.start && end == rhs.end;
+  }
 };
 
 static inline void fromRawValue(
@@ -53,6 +57,10 @@ static inline std::string toString(
 struct AndroidTextInputTextShadowOffsetStruct {
   double width;
   double height;
+
+  bool operator==(AndroidTextInputTextShadowOffsetStruct const &rhs) const {
+    return width == rhs.width && height == rhs.height;
+  }
 };
 
 static inline void fromRawValue(
@@ -103,61 +111,61 @@ class AndroidTextInputProps final : public ViewProps, public BaseTextProps {
 
 #pragma mark - Props
 
-  const std::string autoCompleteType{};
-  const std::string returnKeyLabel{};
-  const int numberOfLines{0};
-  const bool disableFullscreenUI{false};
-  const std::string textBreakStrategy{};
-  const SharedColor underlineColorAndroid{};
-  const std::string inlineImageLeft{};
-  const int inlineImagePadding{0};
-  const std::string importantForAutofill{};
-  const bool showSoftInputOnFocus{false};
-  const std::string autoCapitalize{};
-  const bool autoCorrect{false};
-  const bool autoFocus{false};
-  const bool allowFontScaling{false};
-  const Float maxFontSizeMultiplier{0.0};
-  const bool editable{false};
-  const std::string keyboardType{};
-  const std::string returnKeyType{};
-  const int maxLength{0};
-  const bool multiline{false};
-  const std::string placeholder{};
-  const SharedColor placeholderTextColor{};
-  const bool secureTextEntry{false};
-  const SharedColor selectionColor{};
-  const AndroidTextInputSelectionStruct selection{};
-  const std::string value{};
-  const std::string defaultValue{};
-  const bool selectTextOnFocus{false};
-  const bool blurOnSubmit{false};
-  const bool caretHidden{false};
-  const bool contextMenuHidden{false};
-  const SharedColor textShadowColor{};
-  const Float textShadowRadius{0.0};
-  const std::string textDecorationLine{};
-  const std::string fontStyle{};
-  const AndroidTextInputTextShadowOffsetStruct textShadowOffset{};
-  const Float lineHeight{0.0};
-  const std::string textTransform{};
-  const int color{0};
-  const Float letterSpacing{0.0};
-  const Float fontSize{0.0};
-  const std::string textAlign{};
-  const bool includeFontPadding{false};
-  const std::string fontWeight{};
-  const std::string fontFamily{};
-  const std::string textAlignVertical{};
-  const SharedColor cursorColor{};
-  const int mostRecentEventCount{0};
-  const std::string text{};
+  std::string autoCompleteType{};
+  std::string returnKeyLabel{};
+  int numberOfLines{0};
+  bool disableFullscreenUI{false};
+  std::string textBreakStrategy{};
+  SharedColor underlineColorAndroid{};
+  std::string inlineImageLeft{};
+  int inlineImagePadding{0};
+  std::string importantForAutofill{};
+  bool showSoftInputOnFocus{false};
+  std::string autoCapitalize{};
+  bool autoCorrect{false};
+  bool autoFocus{false};
+  bool allowFontScaling{false};
+  Float maxFontSizeMultiplier{0.0};
+  bool editable{false};
+  std::string keyboardType{};
+  std::string returnKeyType{};
+  int maxLength{0};
+  bool multiline{false};
+  std::string placeholder{};
+  SharedColor placeholderTextColor{};
+  bool secureTextEntry{false};
+  SharedColor selectionColor{};
+  AndroidTextInputSelectionStruct selection{};
+  std::string value{};
+  std::string defaultValue{};
+  bool selectTextOnFocus{false};
+  bool blurOnSubmit{false};
+  bool caretHidden{false};
+  bool contextMenuHidden{false};
+  SharedColor textShadowColor{};
+  Float textShadowRadius{0.0};
+  std::string textDecorationLine{};
+  std::string fontStyle{};
+  AndroidTextInputTextShadowOffsetStruct textShadowOffset{};
+  Float lineHeight{0.0};
+  std::string textTransform{};
+  int color{0};
+  Float letterSpacing{0.0};
+  Float fontSize{0.0};
+  std::string textAlign{};
+  bool includeFontPadding{false};
+  std::string fontWeight{};
+  std::string fontFamily{};
+  std::string textAlignVertical{};
+  SharedColor cursorColor{};
+  int mostRecentEventCount{0};
+  std::string text{};
 
   /*
    * Contains all prop values that affect visual representation of the
    * paragraph.
    */
-  ParagraphAttributes const paragraphAttributes{};
+  ParagraphAttributes paragraphAttributes{};
 
   /**
    * Auxiliary information to detect if these props are set or not.
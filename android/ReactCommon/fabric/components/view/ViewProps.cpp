@@ -11,6 +11,7 @@
 
 #include <react/components/view/conversions.h>
 #include <react/components/view/propsConversions.h>
+#include <react/core/RawPropsFieldTable.h>
 #include <react/core/propsConversions.h>
 #include <react/debug/debugStringConvertibleUtils.h>
 #include <react/graphics/conversions.h>
@@ -18,21 +19,36 @@
 namespace facebook {
 namespace react {
 
+static RawPropsFieldTable<ViewProps> const &viewPropsFieldTable() {
+  using Table = RawPropsFieldTable<ViewProps>;
+  static auto const table = Table{
+      Table::field<Float, &ViewProps::opacity>("opacity"),
+      Table::field<SharedColor, &ViewProps::foregroundColor>("foregroundColor"),
+      Table::field<SharedColor, &ViewProps::backgroundColor>("backgroundColor"),
+      Table::field<SharedColor, &ViewProps::shadowColor>("shadowColor"),
+      Table::field<Size, &ViewProps::shadowOffset>("shadowOffset"),
+      Table::field<Float, &ViewProps::shadowOpacity>("shadowOpacity"),
+      Table::field<Float, &ViewProps::shadowRadius>("shadowRadius"),
+      Table::field<Transform, &ViewProps::transform>("transform"),
+      Table::field<BackfaceVisibility, &ViewProps::backfaceVisibility>(
+          "backfaceVisibility"),
+      Table::field<bool, &ViewProps::shouldRasterize>("shouldRasterize"),
+      Table::field<int, &ViewProps::zIndex>("zIndex"),
+      Table::field<PointerEventsMode, &ViewProps::pointerEvents>(
+          "pointerEvents"),
+      Table::field<EdgeInsets, &ViewProps::hitSlop>("hitSlop"),
+      Table::field<bool, &ViewProps::onLayout>("onLayout"),
+      Table::field<bool, &ViewProps::collapsable>("collapsable"),
+  };
+  return table;
+}
+
 ViewProps::ViewProps(ViewProps const &sourceProps, RawProps const &rawProps)
     : YogaStylableProps(sourceProps, rawProps),
       AccessibilityProps(sourceProps, rawProps),
-      opacity(
-          convertRawProp(rawProps, "opacity", sourceProps.opacity, (Float)1.0)),
-      foregroundColor(convertRawProp(
-          rawProps,
-          "foregroundColor",
-          sourceProps.foregroundColor,
-          {})),
-      backgroundColor(convertRawProp(
-          rawProps,
-          "backgroundColor",
-          sourceProps.backgroundColor,
-          {})),
+      opacity(sourceProps.opacity),
+      foregroundColor(sourceProps.foregroundColor),
+      backgroundColor(sourceProps.backgroundColor),
       borderRadii(convertRawProp(
           rawProps,
           "border",
@@ -51,48 +67,22 @@ ViewProps::ViewProps(ViewProps const &sourceProps, RawProps const &rawProps)
           "Style",
           sourceProps.borderStyles,
           {})),
-      shadowColor(
-          convertRawProp(rawProps, "shadowColor", sourceProps.shadowColor, {})),
-      shadowOffset(convertRawProp(
-          rawProps,
-          "shadowOffset",
-          sourceProps.shadowOffset,
-          {})),
-      shadowOpacity(convertRawProp(
-          rawProps,
-          "shadowOpacity",
-          sourceProps.shadowOpacity,
-          {})),
-      shadowRadius(convertRawProp(
-          rawProps,
-          "shadowRadius",
-          sourceProps.shadowRadius,
-          {})),
-      transform(
-          convertRawProp(rawProps, "transform", sourceProps.transform, {})),
-      backfaceVisibility(convertRawProp(
-          rawProps,
-          "backfaceVisibility",
-          sourceProps.backfaceVisibility,
-          {})),
-      shouldRasterize(convertRawProp(
-          rawProps,
-          "shouldRasterize",
-          sourceProps.shouldRasterize,
-          {})),
-      zIndex(convertRawProp(rawProps, "zIndex", sourceProps.zIndex, {})),
-      pointerEvents(convertRawProp(
-          rawProps,
-          "pointerEvents",
-          sourceProps.pointerEvents,
-          {})),
-      hitSlop(convertRawProp(rawProps, "hitSlop", sourceProps.hitSlop, {})),
-      onLayout(convertRawProp(rawProps, "onLayout", sourceProps.onLayout, {})),
-      collapsable(convertRawProp(
-          rawProps,
-          "collapsable",
-          sourceProps.collapsable,
-          true)){};
+      shadowColor(sourceProps.shadowColor),
+      shadowOffset(sourceProps.shadowOffset),
+      shadowOpacity(sourceProps.shadowOpacity),
+      shadowRadius(sourceProps.shadowRadius),
+      transform(sourceProps.transform),
+      backfaceVisibility(sourceProps.backfaceVisibility),
+      shouldRasterize(sourceProps.shouldRasterize),
+      zIndex(sourceProps.zIndex),
+      pointerEvents(sourceProps.pointerEvents),
+      hitSlop(sourceProps.hitSlop),
+      onLayout(sourceProps.onLayout),
+      collapsable(sourceProps.collapsable) {
+  // Cascaded border props (which are prefixed and suffixed) are parsed above,
+  // the rest of the props are parsed by the table.
+  viewPropsFieldTable().apply(*this, rawProps);
+}
 
 #pragma mark - Convenience Methods
 
@@ -14,12 +14,38 @@ ComponentDescriptor::ComponentDescriptor(
     ComponentDescriptorParameters const &parameters)
     : eventDispatcher_(parameters.eventDispatcher),
       contextContainer_(parameters.contextContainer),
-      flavor_(parameters.flavor) {}
+      flavor_(parameters.flavor) {
+  if (contextContainer_) {
+    propsDiffingEnabled_ = contextContainer_
+                               ->find<bool>(kPropsDiffingContextContainerKey)
+                               .value_or(false);
+  }
+}
 
 ContextContainer::Shared const &ComponentDescriptor::getContextContainer()
     const {
   return contextContainer_;
 }
 
+bool ComponentDescriptor::isPropsDiffingEnabled() const {
+  return propsDiffingEnabled_;
+}
+
+int ComponentDescriptor::getNumberOfClonedProps() const {
+  return propsCloningCounters_->clonedProps;
+}
+
+int ComponentDescriptor::getNumberOfAvoidedPropsClones() const {
+  return propsCloningCounters_->avoidedPropsClones;
+}
+
+void ComponentDescriptor::didCloneProps(bool avoided) const {
+  if (avoided) {
+    propsCloningCounters_->avoidedPropsClones++;
+  } else {
+    propsCloningCounters_->clonedProps++;
+  }
+}
+
 } // namespace react
 } // namespace facebook
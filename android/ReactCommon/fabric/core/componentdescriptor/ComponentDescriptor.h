@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include <react/core/EventDispatcher.h>
 #include <react/core/Props.h>
 #include <react/core/RawPropsParser.h>
@@ -54,6 +57,22 @@ class ComponentDescriptor {
    */
   ContextContainer::Shared const &getContextContainer() const;
 
+  /*
+   * Returns `true` if `cloneProps` returns given `props` object (instead of
+   * a new one) when all values in `rawProps` are equal to the current ones.
+   * Enabled by a `bool` value stored in `ContextContainer` under
+   * `kPropsDiffingContextContainerKey`.
+   */
+  bool isPropsDiffingEnabled() const;
+
+  /*
+   * Returns the number of `Props` objects created by `cloneProps` and the
+   * number of `cloneProps` calls that returned given `props` object because
+   * nothing had changed (props diffing).
+   */
+  int getNumberOfClonedProps() const;
+  int getNumberOfAvoidedPropsClones() const;
+
   /*
    * Returns `componentHandle` associated with particular kind of components.
    * All `ShadowNode`s of this type must return same `componentHandle`.
@@ -127,12 +146,35 @@ class ComponentDescriptor {
       SharedEventTarget eventTarget) const = 0;
 
  protected:
+  /*
+   * To be used by `cloneProps` implementations.
+   */
+  void didCloneProps(bool avoided) const;
+
   EventDispatcher::Weak eventDispatcher_;
   ContextContainer::Shared contextContainer_;
   RawPropsParser rawPropsParser_{};
   Flavor flavor_;
+  bool propsDiffingEnabled_{false};
+
+ private:
+  struct PropsCloningCounters {
+    std::atomic<int> clonedProps{0};
+    std::atomic<int> avoidedPropsClones{0};
+  };
+
+  // Shared between copies of the descriptor, atomics are not copyable.
+  std::shared_ptr<PropsCloningCounters> propsCloningCounters_{
+      std::make_shared<PropsCloningCounters>()};
 };
 
+/*
+ * The key of a `bool` value in `ContextContainer` that enables props diffing
+ * (see `ComponentDescriptor::isPropsDiffingEnabled`).
+ */
+constexpr char const *kPropsDiffingContextContainerKey =
+    "ComponentDescriptor::enablePropsDiffing";
+
 /*
  * Represents a collection of arguments that sufficient to construct a
  * `ComponentDescriptor`.
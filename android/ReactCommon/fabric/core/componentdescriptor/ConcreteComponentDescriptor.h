@@ -12,6 +12,7 @@
 
 #include <react/core/ComponentDescriptor.h>
 #include <react/core/EventDispatcher.h>
+#include <react/core/PoolAllocator.h>
 #include <react/core/Props.h>
 #include <react/core/ShadowNode.h>
 #include <react/core/ShadowNodeFragment.h>
@@ -66,7 +67,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     assert(std::dynamic_pointer_cast<const ConcreteProps>(fragment.props));
 
     auto shadowNode =
-        std::make_shared<ShadowNodeT>(fragment, family, getTraits());
+        makePooledShared<ShadowNodeT>(fragment, family, getTraits());
 
     adopt(shadowNode);
 
@@ -80,7 +81,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
         dynamic_cast<ConcreteShadowNode const *>(&sourceShadowNode) &&
         "Provided `sourceShadowNode` has an incompatible type.");
 
-    auto shadowNode = std::make_shared<ShadowNodeT>(sourceShadowNode, fragment);
+    auto shadowNode = makePooledShared<ShadowNodeT>(sourceShadowNode, fragment);
 
     adopt(shadowNode);
     return shadowNode;
@@ -114,7 +115,18 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
     rawProps.parse(rawPropsParser_);
 
-    return ShadowNodeT::Props(rawProps, props);
+    auto clonedProps = ShadowNodeT::Props(rawProps, props);
+
+    // Props diffing: if applying `rawProps` changed nothing, the source props
+    // object is returned, so the node can be compared (and mounted) as
+    // unchanged.
+    if (propsDiffingEnabled_ && props && rawProps.hasOnlyUnchangedValues()) {
+      didCloneProps(true);
+      return props;
+    }
+
+    didCloneProps(false);
+    return clonedProps;
   };
 
   virtual State::Shared createInitialState(
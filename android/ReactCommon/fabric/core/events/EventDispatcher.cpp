@@ -55,6 +55,18 @@ void EventDispatcher::dispatchStateUpdate(
   getEventQueue(priority).enqueueStateUpdate(std::move(stateUpdate));
 }
 
+EventQueue::StateUpdateStatistics EventDispatcher::getStateUpdateStatistics()
+    const {
+  auto result = EventQueue::StateUpdateStatistics{};
+  for (auto const &eventQueue : eventQueues_) {
+    auto statistics = eventQueue->getStateUpdateStatistics();
+    result.enqueued += statistics.enqueued;
+    result.delivered += statistics.delivered;
+    result.commits += statistics.commits;
+  }
+  return result;
+}
+
 const EventQueue &EventDispatcher::getEventQueue(EventPriority priority) const {
   return *eventQueues_[(int)priority];
 }
@@ -49,6 +49,11 @@ class EventDispatcher {
   void dispatchStateUpdate(StateUpdate &&stateUpdate, EventPriority priority)
       const;
 
+  /*
+   * Returns state update counters summed over all event queues.
+   */
+  EventQueue::StateUpdateStatistics getStateUpdateStatistics() const;
+
  private:
   EventQueue const &getEventQueue(EventPriority priority) const;
 
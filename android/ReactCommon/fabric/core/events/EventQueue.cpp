@@ -7,6 +7,12 @@
 
 #include "EventQueue.h"
 
+#include <algorithm>
+
+#include <better/map.h>
+#include <better/small_vector.h>
+#include <react/core/ShadowNodeFamily.h>
+
 #include "EventEmitter.h"
 
 namespace facebook {
@@ -36,11 +42,17 @@ void EventQueue::enqueueStateUpdate(const StateUpdate &stateUpdate) const {
   {
     std::lock_guard<std::mutex> lock(queueMutex_);
     stateUpdateQueue_.push_back(stateUpdate);
+    stateUpdateStatistics_.enqueued++;
   }
 
   onEnqueue();
 }
 
+EventQueue::StateUpdateStatistics EventQueue::getStateUpdateStatistics() const {
+  std::lock_guard<std::mutex> lock(queueMutex_);
+  return stateUpdateStatistics_;
+}
+
 void EventQueue::onEnqueue() const {
   // Default implementation does nothing.
 }
@@ -104,9 +116,67 @@ void EventQueue::flushStateUpdates() const {
     stateUpdateQueue_.clear();
   }
 
-  for (const auto &stateUpdate : stateUpdateQueue) {
-    statePipe_(stateUpdate);
+  auto stateUpdates = coalesceStateUpdates(std::move(stateUpdateQueue));
+
+  auto surfaceIds = better::small_vector<SurfaceId, 4>{};
+  for (const auto &stateUpdate : stateUpdates) {
+    auto surfaceId = stateUpdate.family->getSurfaceId();
+    if (std::find(surfaceIds.begin(), surfaceIds.end(), surfaceId) ==
+        surfaceIds.end()) {
+      surfaceIds.push_back(surfaceId);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    stateUpdateStatistics_.delivered += stateUpdates.size();
+    stateUpdateStatistics_.commits += surfaceIds.size();
   }
+
+  statePipe_(stateUpdates);
+}
+
+std::vector<StateUpdate> EventQueue::coalesceStateUpdates(
+    std::vector<StateUpdate> &&stateUpdates) {
+  if (stateUpdates.size() < 2) {
+    return std::move(stateUpdates);
+  }
+
+  // Callbacks of every family in the order they were enqueued.
+  auto callbacks = std::vector<std::vector<StateUpdate::Callback>>{};
+  auto indexes = better::map<ShadowNodeFamily const *, size_t>{};
+  auto result = std::vector<StateUpdate>{};
+
+  for (auto &stateUpdate : stateUpdates) {
+    auto pair = indexes.emplace(stateUpdate.family.get(), result.size());
+    if (pair.second) {
+      callbacks.emplace_back();
+      callbacks.back().push_back(std::move(stateUpdate.callback));
+      result.push_back({std::move(stateUpdate.family), nullptr});
+    } else {
+      callbacks[pair.first->second].push_back(std::move(stateUpdate.callback));
+    }
+  }
+
+  for (size_t i = 0; i < result.size(); i++) {
+    if (callbacks[i].size() == 1) {
+      result[i].callback = std::move(callbacks[i].front());
+      continue;
+    }
+
+    // Every callback receives data produced by the previous one, exactly as
+    // if they were applied in separate commits.
+    result[i].callback = [familyCallbacks = std::move(callbacks[i])](
+                             StateData::Shared const &data) {
+      auto newData = data;
+      for (auto const &callback : familyCallbacks) {
+        newData = callback(newData);
+      }
+      return newData;
+    };
+  }
+
+  return result;
 }
 
 } // namespace react
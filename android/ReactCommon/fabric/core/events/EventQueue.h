@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -27,6 +28,20 @@ namespace react {
  */
 class EventQueue {
  public:
+  /*
+   * Counters describing how well state updates are coalesced.
+   * `enqueued` is the number of state updates received by the queue,
+   * `delivered` is the number of updates left after merging updates targeting
+   * the same family, `commits` is the number of shadow tree commits needed to
+   * apply them (one per surface per beat).
+   * `enqueued - commits` is the number of commits saved by coalescing.
+   */
+  struct StateUpdateStatistics {
+    int64_t enqueued{0};
+    int64_t delivered{0};
+    int64_t commits{0};
+  };
+
   EventQueue(
       EventPipe eventPipe,
       StatePipe statePipe,
@@ -45,6 +60,12 @@ class EventQueue {
    */
   void enqueueStateUpdate(const StateUpdate &stateUpdate) const;
 
+  /*
+   * Returns state update counters accumulated since the queue was created.
+   * Can be called on any thread.
+   */
+  StateUpdateStatistics getStateUpdateStatistics() const;
+
  protected:
   /*
    * Called on any enqueue operation.
@@ -57,12 +78,21 @@ class EventQueue {
   void flushEvents(jsi::Runtime &runtime) const;
   void flushStateUpdates() const;
 
+  /*
+   * Merges state updates targeting the same family into one update which
+   * applies all their callbacks in order. The position of the merged update
+   * is the position of the first update of the family.
+   */
+  static std::vector<StateUpdate> coalesceStateUpdates(
+      std::vector<StateUpdate> &&stateUpdates);
+
   const EventPipe eventPipe_;
   const StatePipe statePipe_;
   const std::unique_ptr<EventBeat> eventBeat_;
   // Thread-safe, protected by `queueMutex_`.
   mutable std::vector<RawEvent> eventQueue_;
   mutable std::vector<StateUpdate> stateUpdateQueue_;
+  mutable StateUpdateStatistics stateUpdateStatistics_;
   mutable std::mutex queueMutex_;
 };
 
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "HitTestIndex.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <better/small_vector.h>
+#include <react/core/LayoutableShadowNode.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Maximum number of entries in a leaf bounding volume.
+ */
+static constexpr int kLeafSize = 4;
+
+static bool containsPoint(Rect rect, Point point) {
+  return rect.containsPoint(point);
+}
+
+HitTestIndex::HitTestIndex(ShadowNode::Shared const &rootShadowNode)
+    : rootShadowNode_(rootShadowNode) {
+  addEntries(rootShadowNode_, Point{}, -1);
+
+  entryIndexes_.resize(entries_.size());
+  std::iota(entryIndexes_.begin(), entryIndexes_.end(), 0);
+
+  if (entries_.size() > 0) {
+    volumes_.reserve(entries_.size() * 2 / kLeafSize + 1);
+    volumes_.push_back({});
+    buildVolume(0, 0, static_cast<int>(entries_.size()));
+  }
+}
+
+ShadowNode const &HitTestIndex::getRootShadowNode() const {
+  return *rootShadowNode_;
+}
+
+bool HitTestIndex::contains(ShadowNode const &shadowNode) const {
+  return entryIndexByShadowNode_.find(&shadowNode) !=
+      entryIndexByShadowNode_.end();
+}
+
+ShadowNode::Shared HitTestIndex::findNodeAtPoint(
+    ShadowNode const &shadowNode,
+    Point point) const {
+  auto index = entryIndexByShadowNode_.at(&shadowNode);
+  auto const &entry = entries_[index];
+  auto rootPoint = point + entry.offset;
+
+  if (!containsPoint(entry.frame, rootPoint)) {
+    return nullptr;
+  }
+
+  auto candidates = std::vector<int>{};
+  collectEntries(rootPoint, candidates);
+  std::sort(candidates.begin(), candidates.end());
+
+  // `findNodeAtPoint` descends into the first child containing the point on
+  // every level. Candidates are sorted in pre-order, so the first candidate
+  // which is a child of the current node is exactly that child.
+  auto currentIndex = index;
+  for (auto candidate : candidates) {
+    if (candidate <= index) {
+      continue;
+    }
+
+    if (candidate >= entry.subtreeEndIndex) {
+      break;
+    }
+
+    if (entries_[candidate].parentIndex == currentIndex) {
+      currentIndex = candidate;
+    }
+  }
+
+  return entries_[currentIndex].shadowNode;
+}
+
+void HitTestIndex::addEntries(
+    ShadowNode::Shared const &shadowNode,
+    Point offset,
+    int parentIndex) {
+  auto layoutableShadowNode =
+      dynamic_cast<LayoutableShadowNode const *>(shadowNode.get());
+
+  // Same as `findNodeAtPoint`, such nodes and their descendants are never hit.
+  if (!layoutableShadowNode) {
+    return;
+  }
+
+  auto frame = layoutableShadowNode->getLayoutMetrics().frame;
+  auto transform = layoutableShadowNode->getTransform();
+  auto transformedFrame = frame * transform;
+
+  auto index = static_cast<int>(entries_.size());
+  entries_.push_back({
+      shadowNode,
+      Rect{transformedFrame.origin + offset, transformedFrame.size},
+      offset,
+      parentIndex,
+      0,
+  });
+  entryIndexByShadowNode_[shadowNode.get()] = index;
+
+  auto childOffset = offset + frame.origin * transform;
+  for (auto const &childShadowNode : shadowNode->getChildren()) {
+    addEntries(childShadowNode, childOffset, index);
+  }
+
+  entries_[index].subtreeEndIndex = static_cast<int>(entries_.size());
+}
+
+void HitTestIndex::buildVolume(int volumeIndex, int begin, int end) {
+  auto frame = entries_[entryIndexes_[begin]].frame;
+  for (auto i = begin + 1; i < end; i++) {
+    frame.unionInPlace(entries_[entryIndexes_[i]].frame);
+  }
+
+  if (end - begin <= kLeafSize) {
+    volumes_[volumeIndex] = {frame, begin, end - begin};
+    return;
+  }
+
+  // Splitting entries in halves by their centers along the longer side.
+  auto middle = begin + (end - begin) / 2;
+  auto horizontal = frame.size.width >= frame.size.height;
+  std::nth_element(
+      entryIndexes_.begin() + begin,
+      entryIndexes_.begin() + middle,
+      entryIndexes_.begin() + end,
+      [&](int lhs, int rhs) {
+        auto const &lhsFrame = entries_[lhs].frame;
+        auto const &rhsFrame = entries_[rhs].frame;
+        return horizontal ? lhsFrame.getMidX() < rhsFrame.getMidX()
+                          : lhsFrame.getMidY() < rhsFrame.getMidY();
+      });
+
+  auto first = static_cast<int>(volumes_.size());
+  volumes_.resize(volumes_.size() + 2);
+  volumes_[volumeIndex] = {frame, first, 0};
+
+  buildVolume(first, begin, middle);
+  buildVolume(first + 1, middle, end);
+}
+
+void HitTestIndex::collectEntries(Point point, std::vector<int> &entryIndexes)
+    const {
+  auto stack = better::small_vector<int, 64>{0};
+
+  while (stack.size() > 0) {
+    auto const &volume = volumes_[stack.back()];
+    stack.pop_back();
+
+    if (!containsPoint(volume.frame, point)) {
+      continue;
+    }
+
+    if (volume.count == 0) {
+      stack.push_back(volume.first);
+      stack.push_back(volume.first + 1);
+      continue;
+    }
+
+    for (auto i = volume.first; i < volume.first + volume.count; i++) {
+      auto entryIndex = entryIndexes_[i];
+      if (containsPoint(entries_[entryIndex].frame, point)) {
+        entryIndexes.push_back(entryIndex);
+      }
+    }
+  }
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <better/map.h>
+#include <react/core/ShadowNode.h>
+#include <react/graphics/Geometry.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Spatial index (bounding volume hierarchy) of a laid out shadow tree which
+ * answers the same queries as `LayoutableShadowNode::findNodeAtPoint` without
+ * visiting every node of the tree.
+ * The index is immutable and describes one particular revision of the tree.
+ */
+class HitTestIndex final {
+ public:
+  using Shared = std::shared_ptr<HitTestIndex const>;
+
+  /*
+   * Builds the index for the tree with the given root. Complexity is
+   * `O(n ln(n))`, so building only pays off when several queries are made
+   * against the same revision.
+   */
+  explicit HitTestIndex(ShadowNode::Shared const &rootShadowNode);
+
+  /*
+   * Returns the root node of the indexed tree.
+   */
+  ShadowNode const &getRootShadowNode() const;
+
+  /*
+   * Returns `true` if the given node (not another node of the same family) is
+   * a part of the indexed tree.
+   */
+  bool contains(ShadowNode const &shadowNode) const;
+
+  /*
+   * Returns the same result as `LayoutableShadowNode::findNodeAtPoint` called
+   * for the given node. The node must be a part of the indexed tree.
+   */
+  ShadowNode::Shared findNodeAtPoint(ShadowNode const &shadowNode, Point point)
+      const;
+
+ private:
+  struct Entry {
+    ShadowNode::Shared shadowNode;
+    /*
+     * Hit testable area of the node in coordinates of the root node.
+     */
+    Rect frame;
+    /*
+     * Offset of the coordinate space of the node's frame relative to the
+     * coordinate space of the root node.
+     */
+    Point offset;
+    int parentIndex;
+    /*
+     * Entries are stored in pre-order, so descendants of the node occupy
+     * entries in range (index, subtreeEndIndex).
+     */
+    int subtreeEndIndex;
+  };
+
+  struct BoundingVolume {
+    Rect frame;
+    /*
+     * Leaves refer to `count` consecutive elements of `entryIndexes_` starting
+     * from `first`; other volumes have `count == 0` and two children at
+     * `first` and `first + 1`.
+     */
+    int first;
+    int count;
+  };
+
+  void addEntries(
+      ShadowNode::Shared const &shadowNode,
+      Point offset,
+      int parentIndex);
+  void buildVolume(int volumeIndex, int begin, int end);
+  void collectEntries(Point point, std::vector<int> &entryIndexes) const;
+
+  ShadowNode::Shared rootShadowNode_;
+  std::vector<Entry> entries_;
+  std::vector<int> entryIndexes_;
+  std::vector<BoundingVolume> volumes_;
+  better::map<ShadowNode const *, int> entryIndexByShadowNode_;
+};
+
+} // namespace react
+} // namespace facebook
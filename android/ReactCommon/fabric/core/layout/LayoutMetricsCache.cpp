@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "LayoutMetricsCache.h"
+
+#include <react/core/ShadowNodeFamily.h>
+
+namespace facebook {
+namespace react {
+
+LayoutMetricsCache::LayoutMetricsCache(ShadowNode::Shared const &rootShadowNode)
+    : rootShadowNode_(rootShadowNode) {}
+
+ShadowNode const &LayoutMetricsCache::getRootShadowNode() const {
+  return *rootShadowNode_;
+}
+
+LayoutMetrics LayoutMetricsCache::getRelativeLayoutMetrics(
+    ShadowNode const &shadowNode,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) const {
+  auto &layoutMetrics =
+      policy.includeTransform ? transformedLayoutMetrics_ : layoutMetrics_;
+  auto family = &shadowNode.getFamily();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iterator = layoutMetrics.find(family);
+    if (iterator != layoutMetrics.end()) {
+      return iterator->second;
+    }
+  }
+
+  auto layoutableShadowNode =
+      traitCast<LayoutableShadowNode const *>(&shadowNode);
+  auto layoutableRootShadowNode =
+      traitCast<LayoutableShadowNode const *>(rootShadowNode_.get());
+
+  auto result = EmptyLayoutMetrics;
+  if (layoutableShadowNode && layoutableRootShadowNode) {
+    result = layoutableShadowNode->getRelativeLayoutMetrics(
+        *layoutableRootShadowNode, policy);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  layoutMetrics[family] = result;
+  return result;
+}
+
+} // namespace react
+} // namespace facebook
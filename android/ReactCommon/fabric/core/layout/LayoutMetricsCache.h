@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <better/map.h>
+#include <react/core/LayoutMetrics.h>
+#include <react/core/LayoutableShadowNode.h>
+#include <react/core/ShadowNode.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Memoized layout metrics of nodes relative to the root node of one
+ * particular revision of a shadow tree.
+ * Metrics of a node are computed on the first request (which is `O(depth)`);
+ * repeated requests against the same revision are `O(1)`.
+ * Can be used from any thread.
+ */
+class LayoutMetricsCache final {
+ public:
+  using Shared = std::shared_ptr<LayoutMetricsCache const>;
+
+  explicit LayoutMetricsCache(ShadowNode::Shared const &rootShadowNode);
+
+  /*
+   * Returns the root node of the revision the cache describes.
+   */
+  ShadowNode const &getRootShadowNode() const;
+
+  /*
+   * Returns the same result as `LayoutableShadowNode::getRelativeLayoutMetrics`
+   * called for the newest clone of the given node (in the revision) relative
+   * to the root node.
+   */
+  LayoutMetrics getRelativeLayoutMetrics(
+      ShadowNode const &shadowNode,
+      LayoutableShadowNode::LayoutInspectingPolicy policy) const;
+
+ private:
+  ShadowNode::Shared rootShadowNode_;
+
+  mutable std::mutex mutex_;
+
+  /*
+   * Results are stored per family, which is what the result depends on.
+   * Families of nodes of the revision are retained by the root node, so keys
+   * are never reused by other families while the cache exists.
+   */
+  mutable better::map<ShadowNodeFamily const *, LayoutMetrics>
+      layoutMetrics_; // Protected by `mutex_`.
+  mutable better::map<ShadowNodeFamily const *, LayoutMetrics>
+      transformedLayoutMetrics_; // Protected by `mutex_`.
+};
+
+} // namespace react
+} // namespace facebook
@@ -90,5 +90,34 @@ const RawValue *RawProps::at(
   return parser_->at(*this, RawPropsKey{prefix, name, suffix});
 }
 
+void RawProps::iterateOverValues(
+    std::function<void(RawPropsKey const &key, RawValue const &value)> const
+        &callback) const noexcept {
+  assert(
+      parser_ &&
+      "The object is not parsed. `parse` must be called before iterating.");
+  parser_->iterateOverValues(*this, callback);
+}
+
+void RawProps::markValueAsUnchanged(RawValue const &value) const noexcept {
+  auto valueIndex = &value - values_.data();
+  assert(valueIndex >= 0 && valueIndex < values_.size());
+  unchangedValues_.set(valueIndex);
+}
+
+void RawProps::markValueAsChanged(RawValue const &value) const noexcept {
+  auto valueIndex = &value - values_.data();
+  assert(valueIndex >= 0 && valueIndex < values_.size());
+  changedValues_.set(valueIndex);
+}
+
+bool RawProps::hasOnlyUnchangedValues() const noexcept {
+  assert(
+      parser_ &&
+      "The object is not parsed. `parse` must be called before diffing.");
+  return numberOfUnknownValues_ == 0 && changedValues_.none() &&
+      unchangedValues_.count() == values_.size();
+}
+
 } // namespace react
 } // namespace facebook
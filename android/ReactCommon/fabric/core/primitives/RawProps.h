@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <bitset>
+#include <functional>
 #include <limits>
 
 #include <better/map.h>
@@ -96,6 +98,32 @@ class RawProps final {
   const RawValue *at(char const *name, char const *prefix, char const *suffix)
       const noexcept;
 
+  /*
+   * Calls `callback` for every prop (known to the parser) which has a value in
+   * the object, in a single pass over the parsed values.
+   * Unlike `at`, does not require the props to be accessed in any particular
+   * order.
+   */
+  void iterateOverValues(
+      std::function<void(RawPropsKey const &key, RawValue const &value)> const
+          &callback) const noexcept;
+
+  /*
+   * Props diffing.
+   * Code that applies a value of the object to a `Props` object can report
+   * that the value turned out to be equal to the value the `Props` object
+   * already had (or that it changed it). A value can be consumed by several
+   * members (e.g. `backgroundColor` of `ViewProps` and of `BaseTextProps`),
+   * so every consumer votes: a single "changed" vote wins, and values read
+   * with `at` (which does not diff) count as changed.
+   * If every value of the object was reported unchanged and none changed (and
+   * the object has no props unknown to the parser), applying the object
+   * produces `Props` which are equal to the source ones.
+   */
+  void markValueAsUnchanged(RawValue const &value) const noexcept;
+  void markValueAsChanged(RawValue const &value) const noexcept;
+  bool hasOnlyUnchangedValues() const noexcept;
+
  private:
   friend class RawPropsParser;
 
@@ -130,6 +158,13 @@ class RawProps final {
   mutable better::
       small_vector<RawValue, kNumberOfExplicitlySpecifedPropsSoftCap>
           values_;
+
+  /*
+   * Props diffing artefacts.
+   */
+  mutable int numberOfUnknownValues_{0};
+  mutable std::bitset<kRawPropsValueIndexEmpty> unchangedValues_{};
+  mutable std::bitset<kRawPropsValueIndexEmpty> changedValues_{};
 };
 
 } // namespace react
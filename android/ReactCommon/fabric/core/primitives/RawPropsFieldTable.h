@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include <folly/Likely.h>
+#include <react/core/RawProps.h>
+#include <react/core/RawPropsKey.h>
+#include <react/core/RawValue.h>
+#include <react/core/propsConversions.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Describes a prop which is stored as a member of `PropsT` under a plain
+ * (not prefixed and not suffixed) name.
+ * The setter returns `true` if the value of the member has changed.
+ */
+template <typename PropsT>
+struct RawPropsField {
+  using Setter = bool (*)(PropsT &props, RawValue const &rawValue);
+
+  char const *name;
+  Setter setter;
+};
+
+/*
+ * Assigns the value of a prop to the `member` of `props`.
+ * Follows the same rules as `convertRawProp`: `null` means "the prop was
+ * removed", so the member gets the value it has in default-constructed props.
+ * Returns `true` if the value of the member has changed.
+ */
+template <typename PropsT, typename T, T PropsT::*member>
+bool assignRawPropsField(PropsT &props, RawValue const &rawValue) {
+  if (UNLIKELY(!rawValue.hasValue())) {
+    static PropsT const defaultProps{};
+    if (props.*member == defaultProps.*member) {
+      return false;
+    }
+    props.*member = defaultProps.*member;
+    return true;
+  }
+
+  T result;
+  fromRawValue(rawValue, result);
+  if (props.*member == result) {
+    return false;
+  }
+  props.*member = std::move(result);
+  return true;
+}
+
+/*
+ * Table-driven alternative to calling `convertRawProp` for every member of a
+ * `Props` struct.
+ * The `Props` constructor copies the members from the source props object
+ * and then calls `apply`, which makes a single pass over the values the
+ * `RawProps` object actually has and dispatches each of them to the setter
+ * of the corresponding member. Members that have no value in `RawProps`
+ * (usually the vast majority) cost nothing beyond the copy.
+ * Every applied value is reported to `RawProps` as changed or unchanged
+ * (see `RawProps::markValueAsUnchanged`).
+ * A table is immutable after construction and can be shared across threads;
+ * the intended use is a function-local static in the `Props` translation unit.
+ */
+template <typename PropsT>
+class RawPropsFieldTable final {
+ public:
+  using Field = RawPropsField<PropsT>;
+
+  /*
+   * Describes a prop with the given `name` stored in the given `member`.
+   */
+  template <typename T, T PropsT::*member>
+  static Field field(char const *name) {
+    return {name, &assignRawPropsField<PropsT, T, member>};
+  }
+
+  RawPropsFieldTable(std::initializer_list<Field> fields) : fields_(fields) {
+    std::sort(fields_.begin(), fields_.end(), &isFieldBeforeField);
+  }
+
+  /*
+   * Assigns all members described by the table which have values in
+   * `rawProps`; the rest of the members stay untouched.
+   */
+  void apply(PropsT &props, RawProps const &rawProps) const {
+    if (rawProps.isEmpty()) {
+      // `RawPropsParser` learns the keys of a component by constructing a
+      // `Props` object from empty `RawProps` (which never happens otherwise
+      // because `cloneProps` returns early for those), so the keys must be
+      // accessed here to be recognized later.
+      for (auto const &field : fields_) {
+        rawProps.at(field.name, nullptr, nullptr);
+      }
+      return;
+    }
+
+    rawProps.iterateOverValues(
+        [&](RawPropsKey const &key, RawValue const &rawValue) {
+          if (key.prefix || key.suffix) {
+            return;
+          }
+
+          // Names are compared by identity (as `RawPropsKey` does). A table
+          // must not list props that are requested before it (e.g. by a base
+          // class): whether both requesters would get the value then depends
+          // on whether the linker merges equal string literals.
+          auto iterator = std::lower_bound(
+              fields_.begin(), fields_.end(), key.name, &isFieldBeforeName);
+          if (iterator == fields_.end() || iterator->name != key.name) {
+            return;
+          }
+
+          if (iterator->setter(props, rawValue)) {
+            rawProps.markValueAsChanged(rawValue);
+          } else {
+            rawProps.markValueAsUnchanged(rawValue);
+          }
+        });
+  }
+
+ private:
+  static bool isFieldBeforeName(Field const &field, char const *name) {
+    return std::less<char const *>{}(field.name, name);
+  }
+
+  static bool isFieldBeforeField(Field const &lhs, Field const &rhs) {
+    return isFieldBeforeName(lhs, rhs.name);
+  }
+
+  std::vector<Field> fields_;
+};
+
+} // namespace react
+} // namespace facebook
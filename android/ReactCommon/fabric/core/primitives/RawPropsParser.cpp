@@ -84,8 +84,34 @@ RawValue const *RawPropsParser::at(
   } while (UNLIKELY(key != keys_[rawProps.keyIndexCursor_]));
 
   auto valueIndex = rawProps.keyIndexToValueIndex_[rawProps.keyIndexCursor_];
-  return valueIndex == kRawPropsValueIndexEmpty ? nullptr
-                                                : &rawProps.values_[valueIndex];
+  if (valueIndex == kRawPropsValueIndexEmpty) {
+    return nullptr;
+  }
+
+  // The caller (usually `convertRawProp`) does not report whether the value
+  // changes anything, so it must be treated as changed by props diffing.
+  rawProps.changedValues_.set(valueIndex);
+  return &rawProps.values_[valueIndex];
+}
+
+void RawPropsParser::iterateOverValues(
+    RawProps const &rawProps,
+    std::function<void(RawPropsKey const &key, RawValue const &value)> const
+        &callback) const noexcept {
+  // During initialization, the parser does not know any keys yet, so there is
+  // nothing to iterate over.
+  if (!ready_) {
+    return;
+  }
+
+  for (auto keyIndex = 0; keyIndex < size_; keyIndex++) {
+    auto valueIndex = rawProps.keyIndexToValueIndex_[keyIndex];
+    if (valueIndex == kRawPropsValueIndexEmpty) {
+      continue;
+    }
+
+    callback(keys_[keyIndex], rawProps.values_[valueIndex]);
+  }
 }
 
 void RawPropsParser::postPrepare() noexcept {
@@ -119,6 +145,7 @@ void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
 
         auto keyIndex = nameToIndex_.at(name.data(), name.size());
         if (keyIndex == kRawPropsValueIndexEmpty) {
+          rawProps.numberOfUnknownValues_++;
           continue;
         }
 
@@ -140,6 +167,7 @@ void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
 
         auto keyIndex = nameToIndex_.at(name.data(), name.size());
         if (keyIndex == kRawPropsValueIndexEmpty) {
+          rawProps.numberOfUnknownValues_++;
           continue;
         }
 
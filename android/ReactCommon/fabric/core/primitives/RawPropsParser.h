@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <better/map.h>
 #include <better/small_vector.h>
 #include <react/core/Props.h>
@@ -67,6 +69,14 @@ class RawPropsParser final {
   RawValue const *at(RawProps const &rawProps, RawPropsKey const &key) const
       noexcept;
 
+  /*
+   * To be used by `RawProps` only.
+   */
+  void iterateOverValues(
+      RawProps const &rawProps,
+      std::function<void(RawPropsKey const &key, RawValue const &value)> const
+          &callback) const noexcept;
+
   mutable better::small_vector<RawPropsKey, kNumberOfPropsPerComponentSoftCap>
       keys_{};
   mutable RawPropsKeyMap nameToIndex_{};
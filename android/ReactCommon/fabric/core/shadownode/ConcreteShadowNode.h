@@ -8,6 +8,7 @@
 #pragma once
 
 #include <react/core/ConcreteState.h>
+#include <react/core/PoolAllocator.h>
 #include <react/core/Props.h>
 #include <react/core/ShadowNode.h>
 #include <react/core/StateData.h>
@@ -69,7 +70,7 @@ class ConcreteShadowNode : public BaseShadowNodeT {
   static SharedConcreteProps Props(
       RawProps const &rawProps,
       SharedProps const &baseProps = nullptr) {
-    return std::make_shared<PropsT const>(
+    return makePooledShared<PropsT>(
         baseProps ? static_cast<PropsT const &>(*baseProps) : PropsT(),
         rawProps);
   }
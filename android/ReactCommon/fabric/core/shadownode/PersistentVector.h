@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include <better/small_vector.h>
+#include <react/core/PoolAllocator.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Vector with structural sharing between copies.
+ * Elements are split into chunks of 32: full chunks live in a 32-ary trie
+ * shared between copies of the vector, the last (incomplete) chunk is stored
+ * inline. Copying the vector copies at most 32 elements; appending, replacing
+ * or removing the last element copies only the path from the root of the trie
+ * to the affected chunk, which is `O(log n)` instead of `O(n)`.
+ * Vectors of up to 32 elements (the vast majority of lists of children) have
+ * no trie at all and behave exactly like `better::small_vector`.
+ * Mutable access detaches affected chunks from other copies first, so the type
+ * has the value semantic of a regular vector. Note that non-const `begin()`
+ * and `end()` detach all chunks (copying the whole trie if it is shared);
+ * prefer iterating over const references.
+ */
+template <typename T, size_t InlineCapacity>
+class PersistentVector final {
+  static constexpr int kBits = 5;
+  static constexpr size_t kChunkSize = size_t{1} << kBits;
+  static constexpr size_t kMask = kChunkSize - 1;
+
+  struct Leaf {
+    std::array<T, kChunkSize> items;
+  };
+
+  struct Branch {
+    /*
+     * Points to `Branch`es or to `Leaf`s depending on the level.
+     */
+    std::array<std::shared_ptr<void>, kChunkSize> children;
+  };
+
+  template <bool IsConst>
+  class Iterator final {
+    using VectorPointer = typename std::conditional<
+        IsConst,
+        PersistentVector const *,
+        PersistentVector *>::type;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<IsConst, T const *, T *>::type;
+    using reference = typename std::conditional<IsConst, T const &, T &>::type;
+
+    Iterator() = default;
+
+    Iterator(VectorPointer vector, size_t index)
+        : vector_(vector), index_(index) {}
+
+    template <
+        bool OtherIsConst,
+        typename = typename std::enable_if<IsConst && !OtherIsConst>::type>
+    Iterator(Iterator<OtherIsConst> const &other)
+        : vector_(other.vector_), index_(other.index_) {}
+
+    reference operator*() const {
+      auto chunkBegin = index_ & ~kMask;
+      if (!chunk_ || chunkBegin_ != chunkBegin) {
+        // Mutable iterators are only given out for detached vectors, so
+        // casting constness away is safe.
+        chunk_ = const_cast<pointer>(vector_->getChunk(index_));
+        chunkBegin_ = chunkBegin;
+      }
+      return chunk_[index_ & kMask];
+    }
+
+    pointer operator->() const {
+      return &**this;
+    }
+
+    reference operator[](difference_type offset) const {
+      return *(*this + offset);
+    }
+
+    Iterator &operator++() {
+      index_++;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto result = *this;
+      index_++;
+      return result;
+    }
+
+    Iterator &operator--() {
+      index_--;
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      auto result = *this;
+      index_--;
+      return result;
+    }
+
+    Iterator &operator+=(difference_type offset) {
+      index_ += offset;
+      return *this;
+    }
+
+    Iterator &operator-=(difference_type offset) {
+      index_ -= offset;
+      return *this;
+    }
+
+    Iterator operator+(difference_type offset) const {
+      auto result = *this;
+      return result += offset;
+    }
+
+    friend Iterator operator+(difference_type offset, Iterator iterator) {
+      return iterator += offset;
+    }
+
+    Iterator operator-(difference_type offset) const {
+      auto result = *this;
+      return result -= offset;
+    }
+
+    difference_type operator-(Iterator const &rhs) const {
+      return static_cast<difference_type>(index_) -
+          static_cast<difference_type>(rhs.index_);
+    }
+
+    bool operator==(Iterator const &rhs) const {
+      return index_ == rhs.index_;
+    }
+
+    bool operator!=(Iterator const &rhs) const {
+      return index_ != rhs.index_;
+    }
+
+    bool operator<(Iterator const &rhs) const {
+      return index_ < rhs.index_;
+    }
+
+    bool operator>(Iterator const &rhs) const {
+      return index_ > rhs.index_;
+    }
+
+    bool operator<=(Iterator const &rhs) const {
+      return index_ <= rhs.index_;
+    }
+
+    bool operator>=(Iterator const &rhs) const {
+      return index_ >= rhs.index_;
+    }
+
+   private:
+    template <bool>
+    friend class Iterator;
+
+    VectorPointer vector_{nullptr};
+    size_t index_{0};
+
+    /*
+     * The chunk which contains the current element, cached to make sequential
+     * iteration `O(1)` per element.
+     */
+    mutable pointer chunk_{nullptr};
+    mutable size_t chunkBegin_{0};
+  };
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = T const &;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  PersistentVector() = default;
+
+  PersistentVector(std::initializer_list<T> items)
+      : PersistentVector(items.begin(), items.end()) {}
+
+  template <
+      typename InputIterator,
+      typename = typename std::iterator_traits<
+          InputIterator>::iterator_category>
+  PersistentVector(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  PersistentVector(PersistentVector const &other) = default;
+
+  PersistentVector(PersistentVector &&other)
+      : root_(std::move(other.root_)),
+        shift_(other.shift_),
+        trieSize_(other.trieSize_),
+        tail_(std::move(other.tail_)) {
+    other.clear();
+  }
+
+  PersistentVector &operator=(PersistentVector const &other) = default;
+
+  PersistentVector &operator=(PersistentVector &&other) {
+    root_ = std::move(other.root_);
+    shift_ = other.shift_;
+    trieSize_ = other.trieSize_;
+    tail_ = std::move(other.tail_);
+    other.clear();
+    return *this;
+  }
+
+#pragma mark - Size
+
+  size_t size() const {
+    return trieSize_ + tail_.size();
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  /*
+   * Only the inline chunk can be preallocated.
+   */
+  void reserve(size_t size) {
+    tail_.reserve(std::min(size, size_t{kChunkSize}));
+  }
+
+#pragma mark - Element Access
+
+  T const &operator[](size_t index) const {
+    assert(index < size() && "Index is out of range.");
+    return getChunk(index)[index & kMask];
+  }
+
+  /*
+   * Detaches the chunk containing the element, `O(log n)`.
+   */
+  T &operator[](size_t index) {
+    assert(index < size() && "Index is out of range.");
+    return getMutableChunk(index)[index & kMask];
+  }
+
+  T const &at(size_t index) const {
+    if (index >= size()) {
+      throw std::out_of_range("PersistentVector::at: index is out of range");
+    }
+    return (*this)[index];
+  }
+
+  T const &front() const {
+    return (*this)[0];
+  }
+
+  T const &back() const {
+    return tail_.back();
+  }
+
+#pragma mark - Iterators
+
+  const_iterator begin() const {
+    return const_iterator{this, 0};
+  }
+
+  const_iterator end() const {
+    return const_iterator{this, size()};
+  }
+
+  const_iterator cbegin() const {
+    return begin();
+  }
+
+  const_iterator cend() const {
+    return end();
+  }
+
+  iterator begin() {
+    detachAll();
+    return iterator{this, 0};
+  }
+
+  iterator end() {
+    detachAll();
+    return iterator{this, size()};
+  }
+
+#pragma mark - Modifiers
+
+  void push_back(T value) {
+    if (tail_.size() == kChunkSize) {
+      pushTail();
+    }
+    tail_.push_back(std::move(value));
+  }
+
+  void pop_back() {
+    assert(!empty() && "Vector is empty.");
+    tail_.pop_back();
+    if (tail_.empty() && trieSize_ > 0) {
+      popTail();
+    }
+  }
+
+  void clear() {
+    root_.reset();
+    shift_ = kBits;
+    trieSize_ = 0;
+    tail_.clear();
+  }
+
+#pragma mark - Comparison
+
+  bool operator==(PersistentVector const &rhs) const {
+    return size() == rhs.size() && std::equal(begin(), end(), rhs.begin());
+  }
+
+  bool operator!=(PersistentVector const &rhs) const {
+    return !(*this == rhs);
+  }
+
+ private:
+  /*
+   * Makes the node owned exclusively by the given pointer (copying it if
+   * needed) and returns the node.
+   */
+  template <typename NodeT>
+  static NodeT *detach(std::shared_ptr<void> &node) {
+    if (node.use_count() == 1) {
+      // Synchronizes with releases of the node by its former co-owners.
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } else {
+      node = makePooledShared<NodeT>(*static_cast<NodeT const *>(node.get()));
+    }
+    return static_cast<NodeT *>(node.get());
+  }
+
+  static void detachSubtree(std::shared_ptr<void> &node, int level) {
+    if (level == 0) {
+      detach<Leaf>(node);
+      return;
+    }
+
+    auto branch = detach<Branch>(node);
+    for (auto &child : branch->children) {
+      if (!child) {
+        break;
+      }
+      detachSubtree(child, level - kBits);
+    }
+  }
+
+  static void
+  removeLastLeaf(std::shared_ptr<void> &node, int level, size_t index) {
+    auto branch = detach<Branch>(node);
+    auto &child = branch->children[(index >> level) & kMask];
+
+    if (level == kBits) {
+      child.reset();
+      return;
+    }
+
+    removeLastLeaf(child, level - kBits, index);
+    if (!static_cast<Branch const *>(child.get())->children[0]) {
+      child.reset();
+    }
+  }
+
+  /*
+   * Returns a pointer to the first element of the chunk which contains the
+   * element at the given index.
+   */
+  T const *getChunk(size_t index) const {
+    if (index >= trieSize_) {
+      return tail_.data();
+    }
+
+    void const *node = root_.get();
+    for (auto level = shift_; level > 0; level -= kBits) {
+      node = static_cast<Branch const *>(node)
+                 ->children[(index >> level) & kMask]
+                 .get();
+    }
+    return static_cast<Leaf const *>(node)->items.data();
+  }
+
+  T *getMutableChunk(size_t index) {
+    if (index >= trieSize_) {
+      return tail_.data();
+    }
+
+    auto branch = detach<Branch>(root_);
+    for (auto level = shift_; level > kBits; level -= kBits) {
+      branch = detach<Branch>(branch->children[(index >> level) & kMask]);
+    }
+    return detach<Leaf>(branch->children[(index >> kBits) & kMask])
+        ->items.data();
+  }
+
+  void detachAll() {
+    if (root_) {
+      detachSubtree(root_, shift_);
+    }
+  }
+
+  /*
+   * Moves the full inline chunk into the trie.
+   */
+  void pushTail() {
+    auto leaf = makePooledShared<Leaf>();
+    std::move(tail_.begin(), tail_.end(), leaf->items.begin());
+    tail_.clear();
+
+    if (!root_) {
+      root_ = makePooledShared<Branch>();
+      shift_ = kBits;
+    } else if ((trieSize_ >> kBits) == (size_t{1} << shift_)) {
+      // The trie is full; growing it by one level.
+      auto root = makePooledShared<Branch>();
+      root->children[0] = std::move(root_);
+      root_ = std::move(root);
+      shift_ += kBits;
+    }
+
+    auto branch = detach<Branch>(root_);
+    for (auto level = shift_; level > kBits; level -= kBits) {
+      auto &child = branch->children[(trieSize_ >> level) & kMask];
+      if (!child) {
+        child = makePooledShared<Branch>();
+      }
+      branch = detach<Branch>(child);
+    }
+    branch->children[(trieSize_ >> kBits) & kMask] = std::move(leaf);
+
+    trieSize_ += kChunkSize;
+  }
+
+  /*
+   * Moves the last chunk of the trie into the (empty) inline chunk.
+   */
+  void popTail() {
+    auto index = trieSize_ - kChunkSize;
+    auto chunk = getChunk(index);
+    tail_.assign(chunk, chunk + kChunkSize);
+
+    removeLastLeaf(root_, shift_, index);
+    trieSize_ -= kChunkSize;
+
+    if (trieSize_ == 0) {
+      root_.reset();
+      shift_ = kBits;
+      return;
+    }
+
+    auto const &children = static_cast<Branch const *>(root_.get())->children;
+    if (shift_ > kBits && !children[1]) {
+      // The root has a single child; shrinking the trie by one level.
+      auto child = children[0];
+      root_ = std::move(child);
+      shift_ -= kBits;
+    }
+  }
+
+  std::shared_ptr<void> root_;
+
+  /*
+   * Level of the root node; leaves are at level `0`.
+   */
+  int shift_{kBits};
+
+  /*
+   * Number of elements stored in the trie, always a multiple of `kChunkSize`.
+   */
+  size_t trieSize_{0};
+
+  better::small_vector<T, InlineCapacity> tail_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PoolAllocator.h"
+
+#include <array>
+#include <cassert>
+#include <mutex>
+
+namespace facebook {
+namespace react {
+
+static constexpr size_t kGranularity = 16;
+static constexpr size_t kSizeClassCount =
+    SmallObjectPool::kMaxBlockSize / kGranularity;
+static constexpr size_t kSlabSize = 64 * 1024;
+
+namespace {
+
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+struct SizeClass {
+  std::mutex mutex;
+  FreeBlock *freeBlocks{nullptr};
+  char *slabCursor{nullptr};
+  char *slabEnd{nullptr};
+};
+
+} // namespace
+
+/*
+ * The pool is intentionally leaked: objects allocated from it may be released
+ * by static destructors which run in unspecified order.
+ */
+static SizeClass *getSizeClasses() {
+  static auto sizeClasses = new std::array<SizeClass, kSizeClassCount>{};
+  return sizeClasses->data();
+}
+
+static size_t getSizeClassIndex(size_t size) {
+  assert(size > 0 && size <= SmallObjectPool::kMaxBlockSize);
+  return (size - 1) / kGranularity;
+}
+
+void *SmallObjectPool::allocate(size_t size) {
+  auto index = getSizeClassIndex(size);
+  auto blockSize = (index + 1) * kGranularity;
+  auto &sizeClass = getSizeClasses()[index];
+
+  std::lock_guard<std::mutex> lock(sizeClass.mutex);
+
+  if (sizeClass.freeBlocks) {
+    auto block = sizeClass.freeBlocks;
+    sizeClass.freeBlocks = block->next;
+    return block;
+  }
+
+  if (sizeClass.slabEnd - sizeClass.slabCursor <
+      static_cast<std::ptrdiff_t>(blockSize)) {
+    // The tail of the previous slab (if any) is smaller than a block and is
+    // simply abandoned.
+    sizeClass.slabCursor = static_cast<char *>(::operator new(kSlabSize));
+    sizeClass.slabEnd = sizeClass.slabCursor + kSlabSize;
+  }
+
+  auto block = sizeClass.slabCursor;
+  sizeClass.slabCursor += blockSize;
+  return block;
+}
+
+void SmallObjectPool::deallocate(void *pointer, size_t size) noexcept {
+  if (!pointer) {
+    return;
+  }
+
+  auto &sizeClass = getSizeClasses()[getSizeClassIndex(size)];
+
+  std::lock_guard<std::mutex> lock(sizeClass.mutex);
+
+  auto block = static_cast<FreeBlock *>(pointer);
+  block->next = sizeClass.freeBlocks;
+  sizeClass.freeBlocks = block;
+}
+
+} // namespace react
+} // namespace facebook
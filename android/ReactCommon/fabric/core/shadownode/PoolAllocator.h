@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Process-wide pool of small memory blocks which backs allocations of shadow
+ * nodes, child lists and props.
+ * Blocks are grouped by size classes (multiples of 16 bytes); each class
+ * carves its blocks from large slabs and keeps released blocks in a free list,
+ * so building a tree turns into a sequence of pointer bumps or free list pops
+ * and nodes created together end up close to each other in memory.
+ * Shadow nodes outlive the commit which created them (they are shared between
+ * revisions), so the memory is recycled block by block and slabs are never
+ * returned to the system; the footprint of the pool is bounded by the peak
+ * number of simultaneously alive objects.
+ * The pool is thread-safe; blocks can be released on any thread.
+ */
+class SmallObjectPool final {
+ public:
+  /*
+   * Blocks larger than this are allocated with `operator new`.
+   */
+  static constexpr size_t kMaxBlockSize = 1024;
+
+  /*
+   * Returns a block of at least `size` bytes, `0 < size <= kMaxBlockSize`.
+   */
+  static void *allocate(size_t size);
+
+  /*
+   * Returns the block back to the pool; `size` must be the same as the one
+   * used for the allocation.
+   */
+  static void deallocate(void *pointer, size_t size) noexcept;
+};
+
+/*
+ * Standard allocator backed by `SmallObjectPool`; meant to be used with
+ * `std::allocate_shared`, which puts the control block and the object into
+ * a single pooled block.
+ * Over-aligned and big objects fall back to `operator new`.
+ */
+template <typename T>
+class PoolAllocator final {
+ public:
+  using value_type = T;
+
+  PoolAllocator() noexcept = default;
+
+  template <typename U>
+  PoolAllocator(PoolAllocator<U> const &) noexcept {}
+
+  T *allocate(size_t count) {
+    auto size = sizeof(T) * count;
+    if (!isPoolable(size)) {
+      return static_cast<T *>(::operator new(size));
+    }
+    return static_cast<T *>(SmallObjectPool::allocate(size));
+  }
+
+  void deallocate(T *pointer, size_t count) noexcept {
+    auto size = sizeof(T) * count;
+    if (!isPoolable(size)) {
+      ::operator delete(pointer);
+      return;
+    }
+    SmallObjectPool::deallocate(pointer, size);
+  }
+
+  template <typename U>
+  bool operator==(PoolAllocator<U> const &) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(PoolAllocator<U> const &) const noexcept {
+    return false;
+  }
+
+ private:
+  static bool isPoolable(size_t size) {
+    return size > 0 && size <= SmallObjectPool::kMaxBlockSize &&
+        alignof(T) <= alignof(std::max_align_t);
+  }
+};
+
+/*
+ * Pooled counterpart of `std::make_shared`.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> makePooledShared(Args &&... args) {
+  return std::allocate_shared<T>(
+      PoolAllocator<T>{}, std::forward<Args>(args)...);
+}
+
+} // namespace react
+} // namespace facebook
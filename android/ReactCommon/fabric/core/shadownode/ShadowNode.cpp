@@ -8,9 +8,14 @@
 #include "ShadowNode.h"
 #include "ShadowNodeFragment.h"
 
+#include <algorithm>
+
+#include <better/map.h>
+#include <better/set.h>
 #include <better/small_vector.h>
 
 #include <react/core/ComponentDescriptor.h>
+#include <react/core/PoolAllocator.h>
 #include <react/core/ShadowNodeFragment.h>
 #include <react/debug/DebugStringConvertible.h>
 #include <react/debug/debugStringConvertibleUtils.h>
@@ -67,9 +72,7 @@ ShadowNode::ShadowNode(
 
   traits_.set(ShadowNodeTraits::Trait::ChildrenAreShared);
 
-  for (auto const &child : *children_) {
-    child->family_->setParent(family_);
-  }
+  setParentOfChildren();
 
   // The first node of the family gets its state committed automatically.
   family_->setMostRecentState(state_);
@@ -99,9 +102,7 @@ ShadowNode::ShadowNode(
   traits_.set(ShadowNodeTraits::Trait::ChildrenAreShared);
 
   if (fragment.children) {
-    for (const auto &child : *children_) {
-      child->family_->setParent(family_);
-    }
+    setParentOfChildren();
   }
 }
 
@@ -184,6 +185,9 @@ void ShadowNode::appendChild(const ShadowNode::Shared &child) {
   nonConstChildren->push_back(child);
 
   child->family_->setParent(family_);
+  child->family_->childIndexHint_.store(
+      static_cast<int>(nonConstChildren->size() - 1),
+      std::memory_order_relaxed);
 
   stateRevision_ += child->getStateRevision();
 }
@@ -209,6 +213,8 @@ void ShadowNode::replaceChild(
     // replacing in place using the index.
     if (children.at(suggestedIndex).get() == &oldChild) {
       children[suggestedIndex] = newChild;
+      newChild->family_->childIndexHint_.store(
+          suggestedIndex, std::memory_order_relaxed);
       return;
     }
   }
@@ -216,6 +222,8 @@ void ShadowNode::replaceChild(
   for (auto index = 0; index < size; index++) {
     if (children.at(index).get() == &oldChild) {
       children[index] = newChild;
+      newChild->family_->childIndexHint_.store(
+          index, std::memory_order_relaxed);
       return;
     }
   }
@@ -223,13 +231,22 @@ void ShadowNode::replaceChild(
   assert(false && "Child to replace was not found.");
 }
 
+void ShadowNode::setParentOfChildren() const {
+  auto childIndex = 0;
+  for (auto const &child : *children_) {
+    child->family_->setParent(family_);
+    child->family_->childIndexHint_.store(
+        childIndex++, std::memory_order_relaxed);
+  }
+}
+
 void ShadowNode::cloneChildrenIfShared() {
   if (!traits_.check(ShadowNodeTraits::Trait::ChildrenAreShared)) {
     return;
   }
 
   traits_.unset(ShadowNodeTraits::Trait::ChildrenAreShared);
-  children_ = std::make_shared<SharedShadowNodeList>(*children_);
+  children_ = makePooledShared<SharedShadowNodeList>(*children_);
 }
 
 void ShadowNode::setMounted(bool mounted) const {
@@ -275,13 +292,88 @@ ShadowNode::Unshared ShadowNode::cloneTree(
 
     childNode = parentNode.clone({
         ShadowNodeFragment::propsPlaceholder(),
-        std::make_shared<SharedShadowNodeList>(children),
+        makePooledShared<SharedShadowNodeList>(children),
     });
   }
 
   return std::const_pointer_cast<ShadowNode>(childNode);
 }
 
+/*
+ * Maps nodes that have to be cloned to indexes of their children that have to
+ * be cloned as well.
+ */
+using DirtyChildrenMap =
+    better::map<ShadowNode const *, better::small_vector<int, 4>>;
+
+static ShadowNode::Unshared cloneDirtyNode(
+    ShadowNode const &oldShadowNode,
+    DirtyChildrenMap const &dirtyChildren,
+    better::set<ShadowNode const *> const &targets,
+    std::function<ShadowNode::Unshared(ShadowNode const &oldShadowNode)> const
+        &callback) {
+  auto newShadowNode = ShadowNode::Unshared{};
+
+  auto iterator = dirtyChildren.find(&oldShadowNode);
+  if (iterator != dirtyChildren.end()) {
+    auto const &oldChildren = oldShadowNode.getChildren();
+    auto children = oldChildren;
+
+    for (auto childIndex : iterator->second) {
+      children[childIndex] = cloneDirtyNode(
+          *oldChildren.at(childIndex), dirtyChildren, targets, callback);
+      assert(ShadowNode::sameFamily(
+          *oldChildren.at(childIndex), *children[childIndex]));
+    }
+
+    newShadowNode = oldShadowNode.clone({
+        ShadowNodeFragment::propsPlaceholder(),
+        makePooledShared<SharedShadowNodeList>(children),
+    });
+  }
+
+  if (targets.find(&oldShadowNode) != targets.end()) {
+    // The node is a target itself and also an ancestor of some other target.
+    return callback(newShadowNode ? *newShadowNode : oldShadowNode);
+  }
+
+  return newShadowNode;
+}
+
+ShadowNode::Unshared ShadowNode::cloneTree(
+    std::vector<ShadowNodeFamily const *> const &shadowNodeFamilies,
+    std::function<ShadowNode::Unshared(ShadowNode const &oldShadowNode)>
+        callback) const {
+  auto dirtyChildren = DirtyChildrenMap{};
+  auto targets = better::set<ShadowNode const *>{};
+
+  for (auto shadowNodeFamily : shadowNodeFamilies) {
+    auto ancestors = shadowNodeFamily->getAncestors(*this);
+
+    if (ancestors.size() == 0) {
+      continue;
+    }
+
+    auto &parent = ancestors.back();
+    targets.insert(parent.first.get().getChildren().at(parent.second).get());
+
+    for (auto const &ancestor : ancestors) {
+      auto &childIndexes = dirtyChildren[&ancestor.first.get()];
+      if (std::find(
+              childIndexes.begin(), childIndexes.end(), ancestor.second) ==
+          childIndexes.end()) {
+        childIndexes.push_back(ancestor.second);
+      }
+    }
+  }
+
+  if (targets.size() == 0) {
+    return ShadowNode::Unshared{nullptr};
+  }
+
+  return cloneDirtyNode(*this, dirtyChildren, targets, callback);
+}
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
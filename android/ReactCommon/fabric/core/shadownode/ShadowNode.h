@@ -13,6 +13,7 @@
 
 #include <better/small_vector.h>
 #include <react/core/EventEmitter.h>
+#include <react/core/PersistentVector.h>
 #include <react/core/Props.h>
 #include <react/core/ReactPrimitives.h>
 #include <react/core/Sealable.h>
@@ -35,7 +36,7 @@ using SharedShadowNode = std::shared_ptr<const ShadowNode>;
 using WeakShadowNode = std::weak_ptr<const ShadowNode>;
 using UnsharedShadowNode = std::shared_ptr<ShadowNode>;
 using SharedShadowNodeList =
-    better::small_vector<SharedShadowNode, kShadowNodeChildrenSmallVectorSize>;
+    PersistentVector<SharedShadowNode, kShadowNodeChildrenSmallVectorSize>;
 using SharedShadowNodeSharedList = std::shared_ptr<const SharedShadowNodeList>;
 using SharedShadowNodeUnsharedList = std::shared_ptr<SharedShadowNodeList>;
 
@@ -45,7 +46,7 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
   using Weak = std::weak_ptr<ShadowNode const>;
   using Unshared = std::shared_ptr<ShadowNode>;
   using ListOfShared =
-      better::small_vector<Shared, kShadowNodeChildrenSmallVectorSize>;
+      PersistentVector<Shared, kShadowNodeChildrenSmallVectorSize>;
   using SharedListOfShared = std::shared_ptr<ListOfShared const>;
   using UnsharedListOfShared = std::shared_ptr<ListOfShared>;
 
@@ -109,6 +110,19 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
       std::function<ShadowNode::Unshared(ShadowNode const &oldShadowNode)>
           callback) const;
 
+  /*
+   * Same as above but replaces nodes of all given families at once. Every
+   * ancestor shared by several of the nodes is cloned only once. `callback`
+   * is called once for every node found in the tree; families that do not
+   * belong to the tree are skipped.
+   *
+   * Returns `nullptr` if none of the families belong to the tree.
+   */
+  ShadowNode::Unshared cloneTree(
+      std::vector<ShadowNodeFamily const *> const &shadowNodeFamilies,
+      std::function<ShadowNode::Unshared(ShadowNode const &oldShadowNode)>
+          callback) const;
+
 #pragma mark - Getters
 
   ComponentName getComponentName() const;
@@ -210,6 +224,11 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
    */
   void cloneChildrenIfShared();
 
+  /*
+   * Sets the parent family and child index hints of all children.
+   */
+  void setParentOfChildren() const;
+
   /*
    * Pointer to a family object that this shadow node belongs to.
    */
@@ -73,22 +73,30 @@ AncestorList ShadowNodeFamily::getAncestors(
   auto parentNode = &ancestorShadowNode;
   for (auto it = families.rbegin(); it != families.rend(); it++) {
     auto childFamily = *it;
-    auto found = false;
-    auto childIndex = 0;
-    for (const auto &childNode : *parentNode->children_) {
-      if (childNode->family_.get() == childFamily) {
-        ancestors.push_back({*parentNode, childIndex});
-        parentNode = childNode.get();
-        found = true;
-        break;
+    auto const &children = *parentNode->children_;
+    auto size = static_cast<int>(children.size());
+    auto childIndex =
+        childFamily->childIndexHint_.load(std::memory_order_relaxed);
+
+    if (childIndex < 0 || childIndex >= size ||
+        children[childIndex]->family_.get() != childFamily) {
+      // The hint is stale, falling back to the linear search.
+      childIndex = 0;
+      while (childIndex < size &&
+             children[childIndex]->family_.get() != childFamily) {
+        childIndex++;
+      }
+
+      if (childIndex == size) {
+        ancestors.clear();
+        return ancestors;
       }
-      childIndex++;
-    }
 
-    if (!found) {
-      ancestors.clear();
-      return ancestors;
+      childFamily->childIndexHint_.store(childIndex, std::memory_order_relaxed);
     }
+
+    ancestors.push_back({*parentNode, childIndex});
+    parentNode = children[childIndex].get();
   }
 
   return ancestors;
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include <better/mutex.h>
@@ -67,7 +68,8 @@ class ShadowNodeFamily {
    * node and an index of the child of the parent node.
    * Returns an empty array if there is no ancestor-descendant relationship.
    * Can be called from any thread.
-   * The theoretical complexity of the algorithm is `O(ln(n))`. Use it wisely.
+   * The complexity of the algorithm is `O(depth)` as long as child index hints
+   * are accurate; a stale hint costs a linear search among siblings.
    */
   AncestorList getAncestors(ShadowNode const &ancestorShadowNode) const;
 
@@ -131,6 +133,14 @@ class ShadowNodeFamily {
    * For optimization purposes only.
    */
   mutable bool hasParent_{false};
+
+  /*
+   * Index of the most recently seen node of the family among children of its
+   * parent node. Different revisions of the parent might have the child at
+   * different positions, so the value must be validated before use.
+   * For optimization purposes only.
+   */
+  mutable std::atomic<int> childIndexHint_{-1};
 };
 
 } // namespace react
@@ -8,13 +8,20 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include <react/core/StateUpdate.h>
 
 namespace facebook {
 namespace react {
 
-using StatePipe = std::function<void(StateUpdate const &stateUpdate)>;
+/*
+ * Delivers all state updates accumulated during one beat. The list contains at
+ * most one update per `ShadowNodeFamily` (see `EventQueue`); a receiver is
+ * expected to apply all of them in a single commit per surface.
+ */
+using StatePipe =
+    std::function<void(std::vector<StateUpdate> const &stateUpdates)>;
 
 } // namespace react
 } // namespace facebook
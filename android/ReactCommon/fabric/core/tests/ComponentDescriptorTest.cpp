@@ -6,6 +6,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <react/core/RawPropsFieldTable.h>
+#include <react/core/propsConversions.h>
 
 #include "TestComponent.h"
 
@@ -127,3 +129,117 @@ TEST(ComponentDescriptorTest, appendChild) {
   EXPECT_EQ(node1Children.at(0), node2);
   EXPECT_EQ(node1Children.at(1), node3);
 }
+
+TEST(ComponentDescriptorTest, clonePropsWithPropsDiffing) {
+  auto eventDispatcher = std::shared_ptr<EventDispatcher const>();
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert(kPropsDiffingContextContainerKey, true);
+  SharedComponentDescriptor descriptor =
+      std::make_shared<TestComponentDescriptor>(ComponentDescriptorParameters{
+          eventDispatcher, contextContainer, nullptr});
+  EXPECT_TRUE(descriptor->isPropsDiffingEnabled());
+
+  const auto &raw = RawProps(folly::dynamic::object("opacity", 0.5));
+  SharedProps props = descriptor->cloneProps(nullptr, raw);
+
+  // Equal values: the source props object is returned.
+  const auto &sameRaw = RawProps(folly::dynamic::object("opacity", 0.5));
+  EXPECT_EQ(descriptor->cloneProps(props, sameRaw), props);
+
+  // A different value.
+  const auto &otherRaw = RawProps(folly::dynamic::object("opacity", 0.75));
+  EXPECT_NE(descriptor->cloneProps(props, otherRaw), props);
+
+  // A value which is not diffed (not parsed by a field table).
+  const auto &layoutRaw =
+      RawProps(folly::dynamic::object("opacity", 0.5)("width", 10));
+  EXPECT_NE(descriptor->cloneProps(props, layoutRaw), props);
+
+  // A value unknown to the parser.
+  const auto &unknownRaw =
+      RawProps(folly::dynamic::object("opacity", 0.5)("someProp", 1));
+  EXPECT_NE(descriptor->cloneProps(props, unknownRaw), props);
+
+  EXPECT_EQ(descriptor->getNumberOfClonedProps(), 4);
+  EXPECT_EQ(descriptor->getNumberOfAvoidedPropsClones(), 1);
+}
+
+/*
+ * A base class which reads a prop with `convertRawProp` and a field table of
+ * the derived class which lists the same prop (under an equal name stored
+ * elsewhere, as in two translation units).
+ */
+static char const kTextTintColorName[] = "tintColor";
+static char const kTintColorName[] = "tintColor";
+
+class TextLikeProps {
+ public:
+  TextLikeProps() = default;
+  TextLikeProps(TextLikeProps const &sourceProps, RawProps const &rawProps)
+      : textTintColor(convertRawProp(
+            rawProps,
+            kTextTintColorName,
+            sourceProps.textTintColor,
+            0)) {}
+
+  int textTintColor{0};
+};
+
+class TextInputLikeProps : public ViewProps, public TextLikeProps {
+ public:
+  TextInputLikeProps() = default;
+  TextInputLikeProps(
+      TextInputLikeProps const &sourceProps,
+      RawProps const &rawProps)
+      : ViewProps(sourceProps, rawProps),
+        TextLikeProps(sourceProps, rawProps),
+        tintColor(sourceProps.tintColor) {
+    using Table = RawPropsFieldTable<TextInputLikeProps>;
+    static auto const table = Table{
+        Table::field<int, &TextInputLikeProps::tintColor>(kTintColorName),
+    };
+    table.apply(*this, rawProps);
+  }
+
+  int tintColor{0};
+};
+
+static char const TextInputLikeComponentName[] = "TextInputLike";
+
+using TextInputLikeShadowNode = ConcreteViewShadowNode<
+    TextInputLikeComponentName,
+    TextInputLikeProps,
+    ViewEventEmitter>;
+
+using TextInputLikeComponentDescriptor =
+    ConcreteComponentDescriptor<TextInputLikeShadowNode>;
+
+TEST(ComponentDescriptorTest, clonePropsWithPropsDiffingAndSharedProp) {
+  auto eventDispatcher = std::shared_ptr<EventDispatcher const>();
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert(kPropsDiffingContextContainerKey, true);
+  SharedComponentDescriptor descriptor =
+      std::make_shared<TextInputLikeComponentDescriptor>(
+          ComponentDescriptorParameters{
+              eventDispatcher, contextContainer, nullptr});
+
+  // The base class requests the prop first, so only it gets the value (see
+  // `RawPropsKeyMap::reindex`); the table member keeps the source value.
+  auto sourceProps = std::make_shared<TextInputLikeProps>();
+  sourceProps->tintColor = 3;
+  sourceProps->textTintColor = 2;
+
+  const auto &raw = RawProps(folly::dynamic::object("tintColor", 1));
+  auto props = std::static_pointer_cast<TextInputLikeProps const>(
+      descriptor->cloneProps(sourceProps, raw));
+  EXPECT_NE(props, sourceProps);
+  EXPECT_EQ(props->textTintColor, 1);
+  EXPECT_EQ(props->tintColor, 3);
+
+  // Values read with `convertRawProp` are never reported as unchanged, so a
+  // shared prop always produces a new object.
+  const auto &sameRaw = RawProps(folly::dynamic::object("tintColor", 1));
+  EXPECT_NE(descriptor->cloneProps(props, sameRaw), props);
+
+  EXPECT_EQ(descriptor->getNumberOfAvoidedPropsClones(), 0);
+}
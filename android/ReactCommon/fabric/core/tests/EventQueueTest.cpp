@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/core/EventQueue.h>
+
+#include "TestComponent.h"
+
+using namespace facebook::react;
+
+namespace {
+
+class TestEventQueue : public EventQueue {
+ public:
+  using EventQueue::EventQueue;
+  using EventQueue::flushStateUpdates;
+};
+
+StateUpdate::Callback appendCallback(int value) {
+  return [=](StateData::Shared const &data) -> StateData::Shared {
+    auto oldValue = *std::static_pointer_cast<int const>(data);
+    return std::make_shared<int const>(oldValue * 10 + value);
+  };
+}
+
+int applyCallback(StateUpdate const &stateUpdate) {
+  auto data = stateUpdate.callback(std::make_shared<int const>(0));
+  return *std::static_pointer_cast<int const>(data);
+}
+
+} // namespace
+
+TEST(EventQueueTest, coalescesStateUpdatesOfSameFamily) {
+  auto eventDispatcher = std::shared_ptr<EventDispatcher const>();
+  auto descriptor = std::make_shared<TestComponentDescriptor>(
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+  auto createFamily = [&](Tag tag, SurfaceId surfaceId) {
+    return descriptor->createFamily(
+        ShadowNodeFamilyFragment{
+            /* .tag = */ tag,
+            /* .surfaceId = */ surfaceId,
+            /* .eventEmitter = */ nullptr,
+        },
+        nullptr);
+  };
+
+  auto familyA = createFamily(1, 1);
+  auto familyB = createFamily(2, 1);
+  auto familyC = createFamily(3, 2);
+
+  auto delivered = std::vector<std::vector<StateUpdate>>{};
+  auto statePipe = [&](std::vector<StateUpdate> const &stateUpdates) {
+    delivered.push_back(stateUpdates);
+  };
+
+  auto ownerBox = std::make_shared<EventBeat::OwnerBox>();
+  TestEventQueue eventQueue{
+      nullptr, statePipe, std::make_unique<EventBeat>(ownerBox)};
+
+  eventQueue.enqueueStateUpdate({familyA, appendCallback(1)});
+  eventQueue.enqueueStateUpdate({familyB, appendCallback(2)});
+  eventQueue.enqueueStateUpdate({familyA, appendCallback(3)});
+  eventQueue.enqueueStateUpdate({familyC, appendCallback(4)});
+  eventQueue.enqueueStateUpdate({familyA, appendCallback(5)});
+  eventQueue.flushStateUpdates();
+
+  ASSERT_EQ(delivered.size(), 1);
+  auto const &stateUpdates = delivered.front();
+  ASSERT_EQ(stateUpdates.size(), 3);
+
+  // Order of first occurrence is preserved.
+  EXPECT_EQ(stateUpdates[0].family, familyA);
+  EXPECT_EQ(stateUpdates[1].family, familyB);
+  EXPECT_EQ(stateUpdates[2].family, familyC);
+
+  // Callbacks of the same family are applied in the order they were enqueued.
+  EXPECT_EQ(applyCallback(stateUpdates[0]), 135);
+  EXPECT_EQ(applyCallback(stateUpdates[1]), 2);
+  EXPECT_EQ(applyCallback(stateUpdates[2]), 4);
+
+  auto statistics = eventQueue.getStateUpdateStatistics();
+  EXPECT_EQ(statistics.enqueued, 5);
+  EXPECT_EQ(statistics.delivered, 3);
+  EXPECT_EQ(statistics.commits, 2);
+
+  // Nothing is delivered when the queue is empty.
+  eventQueue.flushStateUpdates();
+  EXPECT_EQ(delivered.size(), 1);
+}
@@ -6,6 +6,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <react/core/HitTestIndex.h>
 #include "TestComponent.h"
 
 using namespace facebook::react;
@@ -117,3 +118,64 @@ TEST_F(FindNodeAtPointTest, viewIsScaled) {
 
   EXPECT_EQ(LayoutableShadowNode::findNodeAtPoint(nodeA_, {119, 119}), nodeAA_);
 }
+
+TEST_F(FindNodeAtPointTest, hitTestIndex) {
+  nodeAAA_->_transform = Transform::Identity() * Transform::Scale(0.5, 0.5, 0);
+
+  auto hitTestIndex = HitTestIndex{nodeA_};
+  EXPECT_TRUE(hitTestIndex.contains(*nodeAA_));
+  EXPECT_FALSE(hitTestIndex.contains(*nodeAA_->clone({})));
+
+  auto points = std::vector<facebook::react::Point>{
+      {5, 5}, {105, 105}, {112, 112}, {115, 115}, {119, 119}, {1001, 1001}};
+  for (auto point : points) {
+    EXPECT_EQ(
+        hitTestIndex.findNodeAtPoint(*nodeA_, point),
+        LayoutableShadowNode::findNodeAtPoint(nodeA_, point));
+    EXPECT_EQ(
+        hitTestIndex.findNodeAtPoint(*nodeAA_, point),
+        LayoutableShadowNode::findNodeAtPoint(nodeAA_, point));
+  }
+}
+
+TEST_F(FindNodeAtPointTest, hitTestIndexWithOverlappingSiblings) {
+  // A grid of overlapping 30x30 views with 20 points step inside `nodeAA_`.
+  auto traits = TestShadowNode::BaseTraits();
+  auto siblings = std::vector<std::shared_ptr<TestShadowNode>>{};
+  for (int i = 0; i < 25; i++) {
+    auto family = std::make_shared<ShadowNodeFamily>(
+        ShadowNodeFamilyFragment{
+            /* .tag = */ 100 + i,
+            /* .surfaceId = */ 1,
+            /* .eventEmitter = */ nullptr,
+        },
+        eventDispatcher_,
+        componentDescriptor_);
+    auto node = std::make_shared<TestShadowNode>(
+        ShadowNodeFragment{
+            /* .props = */ std::make_shared<const TestProps>(),
+            /* .children = */ ShadowNode::emptySharedShadowNodeSharedList(),
+        },
+        family,
+        traits);
+
+    auto layoutMetrics = EmptyLayoutMetrics;
+    layoutMetrics.frame = facebook::react::Rect{
+        facebook::react::Point{Float(i % 5 * 20), Float(i / 5 * 20)},
+        facebook::react::Size{30, 30}};
+    node->setLayoutMetrics(layoutMetrics);
+
+    nodeA_->appendChild(node);
+    siblings.push_back(node);
+  }
+
+  auto hitTestIndex = HitTestIndex{nodeA_};
+  for (int x = -5; x < 130; x += 3) {
+    for (int y = -5; y < 130; y += 3) {
+      auto point = facebook::react::Point{Float(x), Float(y)};
+      EXPECT_EQ(
+          hitTestIndex.findNodeAtPoint(*nodeA_, point),
+          LayoutableShadowNode::findNodeAtPoint(nodeA_, point));
+    }
+  }
+}
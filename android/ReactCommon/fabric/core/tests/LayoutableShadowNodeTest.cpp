@@ -6,6 +6,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <react/core/LayoutMetricsCache.h>
 #include "TestComponent.h"
 
 using namespace facebook::react;
@@ -204,3 +205,44 @@ TEST_F(LayoutableShadowNodeTest, relativeLayoutMetricsOnSameNode2) {
   EXPECT_EQ(relativeLayoutMetrics.frame.origin.x, 10);
   EXPECT_EQ(relativeLayoutMetrics.frame.origin.y, 10);
 }
+
+TEST_F(LayoutableShadowNodeTest, layoutMetricsCache) {
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame.size = {1000, 1000};
+  nodeA_->setLayoutMetrics(layoutMetrics);
+  nodeAA_->setLayoutMetrics(layoutMetrics);
+
+  layoutMetrics.frame.origin = {10, 10};
+  layoutMetrics.frame.size = {100, 100};
+  nodeAAA_->_transform = Transform::Scale(0.5, 0.5, 1);
+  nodeAAA_->setLayoutMetrics(layoutMetrics);
+
+  layoutMetrics.frame.origin = {10, 10};
+  layoutMetrics.frame.size = {50, 50};
+  nodeAAAA_->setLayoutMetrics(layoutMetrics);
+
+  LayoutMetricsCache layoutMetricsCache{nodeA_};
+  auto withTransform = LayoutableShadowNode::LayoutInspectingPolicy{
+      /* .includeTransform = */ true};
+  auto withoutTransform = LayoutableShadowNode::LayoutInspectingPolicy{
+      /* .includeTransform = */ false};
+
+  auto expectedLayoutMetrics =
+      nodeAAAA_->getRelativeLayoutMetrics(*nodeA_, withTransform);
+  EXPECT_EQ(
+      layoutMetricsCache.getRelativeLayoutMetrics(*nodeAAAA_, withTransform),
+      expectedLayoutMetrics);
+
+  // Results are memoized per family: the cache describes one revision of the
+  // tree, so it does not observe further changes.
+  layoutMetrics.frame.origin = {20, 20};
+  nodeAAAA_->setLayoutMetrics(layoutMetrics);
+  EXPECT_EQ(
+      layoutMetricsCache.getRelativeLayoutMetrics(*nodeAAAA_, withTransform),
+      expectedLayoutMetrics);
+
+  // Metrics computed without transforms are cached separately.
+  EXPECT_EQ(
+      layoutMetricsCache.getRelativeLayoutMetrics(*nodeAAAA_, withoutTransform),
+      nodeAAAA_->getRelativeLayoutMetrics(*nodeA_, withoutTransform));
+}
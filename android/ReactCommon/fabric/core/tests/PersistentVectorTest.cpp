@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/core/PersistentVector.h>
+
+using namespace facebook::react;
+
+using Vector = PersistentVector<int, 8>;
+
+static std::vector<int> toStdVector(Vector const &vector) {
+  return std::vector<int>(vector.begin(), vector.end());
+}
+
+static Vector createVector(int size) {
+  auto vector = Vector{};
+  for (int i = 0; i < size; i++) {
+    vector.push_back(i);
+  }
+  return vector;
+}
+
+TEST(PersistentVectorTest, handlesElementAccess) {
+  for (auto size : {0, 1, 32, 33, 1024, 1025, 33 * 32 + 5}) {
+    auto vector = createVector(size);
+    ASSERT_EQ(vector.size(), size);
+    for (int i = 0; i < size; i++) {
+      EXPECT_EQ(vector[i], i);
+    }
+
+    auto expected = std::vector<int>(size);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(toStdVector(vector), expected);
+    EXPECT_THROW(vector.at(size), std::out_of_range);
+  }
+}
+
+TEST(PersistentVectorTest, keepsCopiesIndependent) {
+  auto vector = createVector(2000);
+  auto copy = vector;
+
+  copy[5] = -1;
+  copy[1500] = -2;
+  copy[1999] = -3;
+  copy.push_back(2000);
+
+  EXPECT_EQ(vector.size(), 2000);
+  EXPECT_EQ(vector[5], 5);
+  EXPECT_EQ(vector[1500], 1500);
+  EXPECT_EQ(vector[1999], 1999);
+
+  EXPECT_EQ(copy.size(), 2001);
+  EXPECT_EQ(copy[5], -1);
+  EXPECT_EQ(copy[1500], -2);
+  EXPECT_EQ(copy[1999], -3);
+  EXPECT_EQ(copy[2000], 2000);
+
+  copy[5] = 5;
+  copy[1500] = 1500;
+  copy[1999] = 1999;
+  copy.pop_back();
+  EXPECT_EQ(copy, vector);
+}
+
+TEST(PersistentVectorTest, handlesPopBack) {
+  auto vector = createVector(1100);
+  auto copy = vector;
+
+  for (int size = 1100; size > 0; size--) {
+    ASSERT_EQ(copy.size(), size);
+    ASSERT_EQ(copy.back(), size - 1);
+    copy.pop_back();
+  }
+
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(vector.size(), 1100);
+  EXPECT_EQ(vector.back(), 1099);
+
+  copy.push_back(42);
+  EXPECT_EQ(toStdVector(copy), std::vector<int>{42});
+}
+
+TEST(PersistentVectorTest, handlesMutableIterators) {
+  auto vector = createVector(100);
+  auto copy = vector;
+
+  std::reverse(copy.begin(), copy.end());
+
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(vector[i], i);
+    EXPECT_EQ(copy[i], 99 - i);
+  }
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/core/PoolAllocator.h>
+
+using namespace facebook::react;
+
+namespace {
+
+struct LargeObject {
+  char data[SmallObjectPool::kMaxBlockSize * 2];
+};
+
+} // namespace
+
+TEST(PoolAllocatorTest, reusesReleasedBlocks) {
+  auto first = makePooledShared<std::vector<int>>(3, 42);
+  EXPECT_EQ(first->size(), 3);
+  EXPECT_EQ(first->at(2), 42);
+
+  auto address = static_cast<void const *>(first.get());
+  first.reset();
+
+  auto second = makePooledShared<std::vector<int>>(2, 7);
+  EXPECT_EQ(static_cast<void const *>(second.get()), address);
+}
+
+TEST(PoolAllocatorTest, alignsBlocks) {
+  auto objects = std::vector<std::shared_ptr<double>>{};
+  for (int i = 0; i < 100; i++) {
+    objects.push_back(makePooledShared<double>(i));
+  }
+
+  for (auto const &object : objects) {
+    EXPECT_EQ(
+        reinterpret_cast<std::uintptr_t>(object.get()) % alignof(double), 0);
+  }
+}
+
+TEST(PoolAllocatorTest, allocatesLargeObjects) {
+  auto object = makePooledShared<LargeObject>();
+  object->data[sizeof(LargeObject::data) - 1] = 'x';
+  EXPECT_EQ(object->data[sizeof(LargeObject::data) - 1], 'x');
+}
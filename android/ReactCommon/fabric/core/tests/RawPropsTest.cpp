@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 #include <react/core/ConcreteShadowNode.h>
+#include <react/core/RawPropsFieldTable.h>
 #include <react/core/ShadowNode.h>
 #include <react/core/propsConversions.h>
 
@@ -118,6 +119,31 @@ class PropsMultiLookup : public Props {
   const float derivedFloatValue{40};
 };
 
+class PropsWithFieldTable : public Props {
+ public:
+  PropsWithFieldTable() = default;
+  PropsWithFieldTable(
+      const PropsWithFieldTable &sourceProps,
+      const RawProps &rawProps)
+      : Props(sourceProps, rawProps),
+        intValue(sourceProps.intValue),
+        stringValue(sourceProps.stringValue),
+        boolValue(sourceProps.boolValue) {
+    using Table = RawPropsFieldTable<PropsWithFieldTable>;
+    static auto const table = Table{
+        Table::field<int, &PropsWithFieldTable::intValue>("intValue"),
+        Table::field<std::string, &PropsWithFieldTable::stringValue>(
+            "stringValue"),
+        Table::field<bool, &PropsWithFieldTable::boolValue>("boolValue"),
+    };
+    table.apply(*this, rawProps);
+  }
+
+  int intValue{17};
+  std::string stringValue{"default"};
+  bool boolValue{true};
+};
+
 TEST(RawPropsTest, handleProps) {
   const auto &raw = RawProps(folly::dynamic::object("nativeID", "abc"));
   auto parser = RawPropsParser();
@@ -305,3 +331,29 @@ TEST(RawPropsTest, handlePropsMultiLookup) {
   EXPECT_NEAR(props->floatValue, 10.0, 0.00001);
   EXPECT_NEAR(props->derivedFloatValue, 20.0, 0.00001);
 }
+
+TEST(RawPropsTest, handlePropsWithFieldTable) {
+  auto parser = RawPropsParser();
+  parser.prepare<PropsWithFieldTable>();
+
+  const auto &raw = RawProps(folly::dynamic::object("intValue", (int)42)(
+      "stringValue", "helloworld")("nativeID", "abc"));
+  raw.parse(parser);
+  auto props = PropsWithFieldTable(PropsWithFieldTable(), raw);
+
+  EXPECT_EQ(props.intValue, 42);
+  EXPECT_STREQ(props.stringValue.c_str(), "helloworld");
+  EXPECT_EQ(props.boolValue, true);
+  EXPECT_STREQ(props.nativeId.c_str(), "abc");
+
+  // Props which are absent keep source values, `null` resets to defaults.
+  const auto &otherRaw = RawProps(
+      folly::dynamic::object("stringValue", nullptr)("boolValue", false));
+  otherRaw.parse(parser);
+  auto otherProps = PropsWithFieldTable(props, otherRaw);
+
+  EXPECT_EQ(otherProps.intValue, 42);
+  EXPECT_STREQ(otherProps.stringValue.c_str(), "default");
+  EXPECT_EQ(otherProps.boolValue, false);
+  EXPECT_STREQ(otherProps.nativeId.c_str(), "abc");
+}
@@ -290,3 +290,69 @@ TEST_F(ShadowNodeTest, handleState) {
   secondNode->sealRecursive();
   EXPECT_ANY_THROW(secondNode->setStateData(TestState{42}));
 }
+
+TEST_F(ShadowNodeTest, handleCloneTreeWithMultipleFamilies) {
+  auto clonedNodes = std::vector<ShadowNode const *>{};
+  auto callback = [&](ShadowNode const &oldShadowNode) {
+    clonedNodes.push_back(&oldShadowNode);
+    return oldShadowNode.clone({});
+  };
+
+  auto families = std::vector<ShadowNodeFamily const *>{
+      &nodeABA_->getFamily(),
+      &nodeAC_->getFamily(),
+      &nodeABB_->getFamily(),
+      &nodeZ_->getFamily(),
+  };
+
+  auto newNodeA = nodeA_->cloneTree(families, callback);
+  ASSERT_NE(newNodeA, nullptr);
+
+  // `nodeZ_` does not belong to the tree, the rest is cloned exactly once.
+  EXPECT_EQ(clonedNodes.size(), 3);
+
+  auto const &children = newNodeA->getChildren();
+  EXPECT_EQ(children.at(0), nodeAA_);
+  EXPECT_NE(children.at(1), nodeAB_);
+  EXPECT_NE(children.at(2), nodeAC_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*children.at(1), *nodeAB_));
+  EXPECT_TRUE(ShadowNode::sameFamily(*children.at(2), *nodeAC_));
+
+  auto const &grandchildren = children.at(1)->getChildren();
+  EXPECT_NE(grandchildren.at(0), nodeABA_);
+  EXPECT_NE(grandchildren.at(1), nodeABB_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*grandchildren.at(0), *nodeABA_));
+  EXPECT_TRUE(ShadowNode::sameFamily(*grandchildren.at(1), *nodeABB_));
+
+  // None of the families belong to the tree.
+  auto otherFamilies =
+      std::vector<ShadowNodeFamily const *>{&nodeAA_->getFamily()};
+  EXPECT_EQ(nodeAB_->cloneTree(otherFamilies, callback), nullptr);
+}
+
+TEST_F(ShadowNodeTest, handleAncestorsOfReorderedChildren) {
+  auto nodeABRevision2 = nodeAB_->clone(
+      {ShadowNodeFragment::propsPlaceholder(),
+       std::make_shared<SharedShadowNodeList>(
+           SharedShadowNodeList{nodeABB_, nodeABA_})});
+  auto nodeARevision2 = nodeA_->clone(
+      {ShadowNodeFragment::propsPlaceholder(),
+       std::make_shared<SharedShadowNodeList>(
+           SharedShadowNodeList{nodeAA_, nodeABRevision2, nodeAC_})});
+
+  auto &familyABA = nodeABA_->getFamily();
+
+  // Child index hints are updated by the most recent revision; both
+  // revisions must still be resolved correctly.
+  for (auto i = 0; i < 2; i++) {
+    auto ancestors = familyABA.getAncestors(*nodeA_);
+    ASSERT_EQ(ancestors.size(), 2);
+    EXPECT_EQ(&ancestors[1].first.get(), nodeAB_.get());
+    EXPECT_EQ(ancestors[1].second, 0);
+
+    auto ancestorsRevision2 = familyABA.getAncestors(*nodeARevision2);
+    ASSERT_EQ(ancestorsRevision2.size(), 2);
+    EXPECT_EQ(&ancestorsRevision2[1].first.get(), nodeABRevision2.get());
+    EXPECT_EQ(ancestorsRevision2[1].second, 1);
+  }
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <react/components/view/ViewComponentDescriptor.h>
+#include <react/core/EventDispatcher.h>
+#include <react/core/ShadowNodeFragment.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Fixture shared by the shadow node benchmarks: a `ViewComponentDescriptor`
+ * without an event dispatcher and helpers that create views with default
+ * props on surface 1.
+ */
+
+inline ViewComponentDescriptor const &benchmarkComponentDescriptor() {
+  static auto contextContainer = std::make_shared<ContextContainer const>();
+  static auto componentDescriptor =
+      ViewComponentDescriptor{ComponentDescriptorParameters{
+          std::shared_ptr<EventDispatcher>{nullptr}, contextContainer}};
+  return componentDescriptor;
+}
+
+inline ShadowNodeFamily::Shared createBenchmarkFamily(Tag tag) {
+  return benchmarkComponentDescriptor().createFamily(
+      ShadowNodeFamilyFragment{
+          /* .tag = */ tag,
+          /* .surfaceId = */ 1,
+          /* .eventEmitter = */ nullptr,
+      },
+      nullptr);
+}
+
+inline ShadowNode::Shared createBenchmarkNode(
+    Tag tag,
+    SharedShadowNodeSharedList const &children) {
+  return benchmarkComponentDescriptor().createShadowNode(
+      ShadowNodeFragment{
+          /* .props = */ ViewShadowNode::defaultSharedProps(),
+          /* .children = */ children,
+      },
+      createBenchmarkFamily(tag));
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <better/small_vector.h>
+
+#include "BenchmarkViewNodes.h"
+
+namespace facebook {
+namespace react {
+
+/*
+ * Measures updates of a single child of a wide container: copying the list of
+ * children and replacing (or appending) one element, which is what `cloneTree`
+ * does on every level, compared with the same operations on a flat
+ * `better::small_vector`, which lists of children used to be.
+ */
+
+using FlatShadowNodeList = better::small_vector<ShadowNode::Shared, 8>;
+
+static SharedShadowNodeList createChildList(int size) {
+  auto children = SharedShadowNodeList{};
+  for (int i = 0; i < size; i++) {
+    children.push_back(createBenchmarkNode(
+        i + 1, ShadowNode::emptySharedShadowNodeSharedList()));
+  }
+  return children;
+}
+
+static void childListReplace(benchmark::State &state) {
+  auto children = createChildList(state.range(0));
+  auto newChild = children[0];
+  auto index = children.size() / 2;
+
+  for (auto _ : state) {
+    auto newChildren = children;
+    newChildren[index] = newChild;
+    benchmark::DoNotOptimize(newChildren);
+  }
+}
+BENCHMARK(childListReplace)->Arg(8)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void flatChildListReplace(benchmark::State &state) {
+  auto sourceChildren = createChildList(state.range(0));
+  auto children =
+      FlatShadowNodeList(sourceChildren.begin(), sourceChildren.end());
+  auto newChild = children[0];
+  auto index = children.size() / 2;
+
+  for (auto _ : state) {
+    auto newChildren = children;
+    newChildren[index] = newChild;
+    benchmark::DoNotOptimize(newChildren);
+  }
+}
+BENCHMARK(flatChildListReplace)->Arg(8)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void childListAppend(benchmark::State &state) {
+  auto children = createChildList(state.range(0));
+  auto newChild = children[0];
+
+  for (auto _ : state) {
+    auto newChildren = children;
+    newChildren.push_back(newChild);
+    benchmark::DoNotOptimize(newChildren);
+  }
+}
+BENCHMARK(childListAppend)->Arg(8)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void flatChildListAppend(benchmark::State &state) {
+  auto sourceChildren = createChildList(state.range(0));
+  auto children =
+      FlatShadowNodeList(sourceChildren.begin(), sourceChildren.end());
+  auto newChild = children[0];
+
+  for (auto _ : state) {
+    auto newChildren = children;
+    newChildren.push_back(newChild);
+    benchmark::DoNotOptimize(newChildren);
+  }
+}
+BENCHMARK(flatChildListAppend)->Arg(8)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void childListCloneTree(benchmark::State &state) {
+  auto children = createChildList(state.range(0));
+  auto &family = children[children.size() / 2]->getFamily();
+  auto rootShadowNode = createBenchmarkNode(
+      0, std::make_shared<SharedShadowNodeList const>(children));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rootShadowNode->cloneTree(
+        family, [](ShadowNode const &oldShadowNode) {
+          return oldShadowNode.clone({});
+        }));
+  }
+}
+BENCHMARK(childListCloneTree)->Arg(8)->Arg(100)->Arg(1000)->Arg(10000);
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "BenchmarkViewNodes.h"
+
+namespace facebook {
+namespace react {
+
+/*
+ * Compares applying N simultaneous updates to a deep tree with N consecutive
+ * single-family `cloneTree` calls and with one multi-family call.
+ * The tree is a complete tree with 4 children per node and depth 6, which
+ * gives 4096 leaves; updated leaves are spread evenly across the tree.
+ */
+
+static ShadowNode::Shared buildTree(
+    int depth,
+    Tag &tag,
+    std::vector<ShadowNodeFamily const *> &leafFamilies) {
+  auto children = std::make_shared<SharedShadowNodeList>();
+
+  if (depth > 0) {
+    for (int i = 0; i < 4; i++) {
+      children->push_back(buildTree(depth - 1, tag, leafFamilies));
+    }
+  }
+
+  auto shadowNode = createBenchmarkNode(tag++, children);
+
+  if (depth == 0) {
+    leafFamilies.push_back(&shadowNode->getFamily());
+  }
+
+  return shadowNode;
+}
+
+static std::vector<ShadowNodeFamily const *> updatedFamilies(
+    std::vector<ShadowNodeFamily const *> const &leafFamilies,
+    size_t count) {
+  auto result = std::vector<ShadowNodeFamily const *>{};
+  auto step = leafFamilies.size() / count;
+  for (size_t i = 0; i < leafFamilies.size() && result.size() < count;
+       i += step) {
+    result.push_back(leafFamilies[i]);
+  }
+  return result;
+}
+
+static ShadowNode::Unshared cloneLeaf(ShadowNode const &oldShadowNode) {
+  return oldShadowNode.clone({});
+}
+
+static void cloneTreeConsecutively(benchmark::State &state) {
+  auto tag = Tag{1};
+  auto leafFamilies = std::vector<ShadowNodeFamily const *>{};
+  auto rootShadowNode = buildTree(6, tag, leafFamilies);
+  auto families = updatedFamilies(leafFamilies, state.range(0));
+
+  for (auto _ : state) {
+    auto newRootShadowNode = rootShadowNode;
+    for (auto family : families) {
+      newRootShadowNode = newRootShadowNode->cloneTree(*family, cloneLeaf);
+    }
+    benchmark::DoNotOptimize(newRootShadowNode);
+  }
+}
+BENCHMARK(cloneTreeConsecutively)->Arg(1)->Arg(16)->Arg(256);
+
+static void cloneTreeBatched(benchmark::State &state) {
+  auto tag = Tag{1};
+  auto leafFamilies = std::vector<ShadowNodeFamily const *>{};
+  auto rootShadowNode = buildTree(6, tag, leafFamilies);
+  auto families = updatedFamilies(leafFamilies, state.range(0));
+
+  for (auto _ : state) {
+    auto newRootShadowNode = rootShadowNode->cloneTree(families, cloneLeaf);
+    benchmark::DoNotOptimize(newRootShadowNode);
+  }
+}
+BENCHMARK(cloneTreeBatched)->Arg(1)->Arg(16)->Arg(256);
+
+} // namespace react
+} // namespace facebook
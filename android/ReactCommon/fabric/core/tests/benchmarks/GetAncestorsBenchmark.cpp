@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "BenchmarkViewNodes.h"
+
+namespace facebook {
+namespace react {
+
+/*
+ * Measures `ShadowNodeFamily::getAncestors` on a tree of nested 1000-wide
+ * containers (like nested long lists) with depth 4. The path to the looked up
+ * node goes through the last child of every container.
+ * With stale child index hints every level falls back to the linear search,
+ * which is what every lookup did before the hints were introduced.
+ */
+
+static constexpr int kContainerWidth = 1000;
+static constexpr int kDepth = 4;
+
+/*
+ * Builds the tree and its second revision where the path to the leaf goes
+ * through the middle child of every container instead of the last one.
+ */
+static std::pair<ShadowNode::Shared, ShadowNode::Shared> buildTrees(
+    ShadowNode::Shared &leafNode) {
+  auto tag = Tag{1};
+  leafNode = createBenchmarkNode(
+      tag++, ShadowNode::emptySharedShadowNodeSharedList());
+
+  auto node = leafNode;
+  auto movedNode = leafNode;
+  for (int level = 0; level < kDepth; level++) {
+    auto children = SharedShadowNodeList{};
+    auto movedChildren = SharedShadowNodeList{};
+    for (int i = 0; i < kContainerWidth - 1; i++) {
+      if (i == kContainerWidth / 2) {
+        movedChildren.push_back(movedNode);
+      }
+      auto child = createBenchmarkNode(
+          tag++, ShadowNode::emptySharedShadowNodeSharedList());
+      children.push_back(child);
+      movedChildren.push_back(child);
+    }
+    children.push_back(node);
+
+    auto container = createBenchmarkNode(
+        tag++, std::make_shared<SharedShadowNodeList>(children));
+    movedNode = container->clone(
+        {ShadowNodeFragment::propsPlaceholder(),
+         std::make_shared<SharedShadowNodeList>(movedChildren)});
+    node = container;
+  }
+
+  return {node, movedNode};
+}
+
+static void getAncestorsWithAccurateHints(benchmark::State &state) {
+  auto leafNode = ShadowNode::Shared{};
+  auto trees = buildTrees(leafNode);
+  auto &family = leafNode->getFamily();
+
+  // The first lookup makes hints point to positions in the first tree.
+  family.getAncestors(*trees.first);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(family.getAncestors(*trees.first));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(getAncestorsWithAccurateHints);
+
+static void getAncestorsWithStaleHints(benchmark::State &state) {
+  auto leafNode = ShadowNode::Shared{};
+  auto trees = buildTrees(leafNode);
+  auto &family = leafNode->getFamily();
+
+  // Alternating between revisions makes every hint stale.
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(family.getAncestors(*trees.first));
+    benchmark::DoNotOptimize(family.getAncestors(*trees.second));
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(getAncestorsWithStaleHints);
+
+} // namespace react
+} // namespace facebook
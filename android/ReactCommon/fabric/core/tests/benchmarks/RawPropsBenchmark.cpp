@@ -8,9 +8,12 @@
 #include <benchmark/benchmark.h>
 #include <folly/dynamic.h>
 #include <folly/json.h>
+#include <react/components/androidtextinput/AndroidTextInputProps.h>
+#include <react/components/scrollview/ScrollViewProps.h>
 #include <react/components/view/ViewComponentDescriptor.h>
 #include <react/core/EventDispatcher.h>
 #include <react/core/RawProps.h>
+#include <react/core/RawPropsParser.h>
 #include <react/utils/ContextContainer.h>
 #include <exception>
 #include <string>
@@ -74,6 +77,88 @@ static void propParsingRegularRawPropsWithNoSourceProps(
 }
 BENCHMARK(propParsingRegularRawPropsWithNoSourceProps);
 
+/*
+ * Parsing of props of built-in components (which use `RawPropsFieldTable`)
+ * for an initial render (many props) and for a typical update (one prop).
+ */
+
+template <typename PropsT>
+static RawPropsParser const &builtInPropsParser() {
+  static auto const parser = [] {
+    auto parser = RawPropsParser{};
+    parser.prepare<PropsT>();
+    return parser;
+  }();
+  return parser;
+}
+
+template <typename PropsT>
+static void builtInPropParsing(
+    benchmark::State &state,
+    folly::dynamic const &dynamic) {
+  auto const &parser = builtInPropsParser<PropsT>();
+  auto const sourceProps = PropsT{};
+  for (auto _ : state) {
+    RawProps rawProps{dynamic};
+    rawProps.parse(parser);
+    benchmark::DoNotOptimize(PropsT(sourceProps, rawProps));
+  }
+}
+
+auto viewPropsDynamic = folly::parseJson(
+    "{\"flex\": 1, \"opacity\": 0.5, \"backgroundColor\": 4278190335, "
+    "\"zIndex\": 2, \"borderRadius\": 4, \"pointerEvents\": \"box-none\", "
+    "\"nativeID\": \"some-id\", \"collapsable\": false}");
+auto viewPropsUpdateDynamic = folly::parseJson("{\"opacity\": 0.75}");
+
+auto scrollViewPropsDynamic = folly::parseJson(
+    "{\"flex\": 1, \"pagingEnabled\": true, \"scrollEventThrottle\": 16, "
+    "\"showsVerticalScrollIndicator\": false, \"decelerationRate\": 0.99, "
+    "\"contentInset\": {\"top\": 10, \"left\": 0, \"bottom\": 10, "
+    "\"right\": 0}, \"snapToInterval\": 100, \"keyboardDismissMode\": "
+    "\"on-drag\"}");
+auto scrollViewPropsUpdateDynamic =
+    folly::parseJson("{\"scrollEnabled\": false}");
+
+auto textInputPropsDynamic = folly::parseJson(
+    "{\"value\": \"Hello\", \"placeholder\": \"Type here\", "
+    "\"multiline\": true, \"maxLength\": 140, \"autoCorrect\": false, "
+    "\"fontSize\": 14, \"padding\": 8, \"underlineColorAndroid\": 0, "
+    "\"mostRecentEventCount\": 1}");
+auto textInputPropsUpdateDynamic =
+    folly::parseJson("{\"value\": \"Hello!\", \"mostRecentEventCount\": 2}");
+
+static void viewPropParsing(benchmark::State &state) {
+  builtInPropParsing<ViewProps>(state, viewPropsDynamic);
+}
+BENCHMARK(viewPropParsing);
+
+static void viewPropParsingUpdate(benchmark::State &state) {
+  builtInPropParsing<ViewProps>(state, viewPropsUpdateDynamic);
+}
+BENCHMARK(viewPropParsingUpdate);
+
+static void scrollViewPropParsing(benchmark::State &state) {
+  builtInPropParsing<ScrollViewProps>(state, scrollViewPropsDynamic);
+}
+BENCHMARK(scrollViewPropParsing);
+
+static void scrollViewPropParsingUpdate(benchmark::State &state) {
+  builtInPropParsing<ScrollViewProps>(state, scrollViewPropsUpdateDynamic);
+}
+BENCHMARK(scrollViewPropParsingUpdate);
+
+static void textInputPropParsing(benchmark::State &state) {
+  builtInPropParsing<AndroidTextInputProps>(state, textInputPropsDynamic);
+}
+BENCHMARK(textInputPropParsing);
+
+static void textInputPropParsingUpdate(benchmark::State &state) {
+  builtInPropParsing<AndroidTextInputProps>(
+      state, textInputPropsUpdateDynamic);
+}
+BENCHMARK(textInputPropParsingUpdate);
+
 } // namespace react
 } // namespace facebook
 
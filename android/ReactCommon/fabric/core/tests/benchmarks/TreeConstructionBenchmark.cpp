@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/core/PoolAllocator.h>
+#include <react/core/RawProps.h>
+#include <react/core/RawPropsParser.h>
+#include <vector>
+
+#include "BenchmarkViewNodes.h"
+
+namespace facebook {
+namespace react {
+
+/*
+ * Measures construction of a complete tree of views with 8 children per node
+ * (the way a screen is built during the first render): every node gets its
+ * own props, child list and shadow node.
+ * The pooled variant goes through the component descriptor (which allocates
+ * from `SmallObjectPool`); the baseline performs the same allocations with
+ * `std::make_shared`. Families are created upfront and reused by both.
+ */
+
+static auto treeConstructionPropsDynamic =
+    folly::dynamic::object("flex", 1)("opacity", 0.5);
+
+static constexpr int kFanout = 8;
+
+static std::vector<ShadowNodeFamily::Shared> createFamilies(int count) {
+  auto families = std::vector<ShadowNodeFamily::Shared>{};
+  families.reserve(count);
+  for (int i = 0; i < count; i++) {
+    families.push_back(createBenchmarkFamily(i + 1));
+  }
+  return families;
+}
+
+static int countNodes(int depth) {
+  return depth == 0 ? 1 : 1 + kFanout * countNodes(depth - 1);
+}
+
+static ShadowNode::Shared buildPooledTree(
+    int depth,
+    std::vector<ShadowNodeFamily::Shared>::const_iterator &family) {
+  auto children = makePooledShared<SharedShadowNodeList>();
+  if (depth > 0) {
+    for (int i = 0; i < kFanout; i++) {
+      children->push_back(buildPooledTree(depth - 1, family));
+    }
+  }
+
+  RawProps rawProps{treeConstructionPropsDynamic};
+  auto props = benchmarkComponentDescriptor().cloneProps(
+      ViewShadowNode::defaultSharedProps(), rawProps);
+
+  return benchmarkComponentDescriptor().createShadowNode(
+      ShadowNodeFragment{
+          /* .props = */ props,
+          /* .children = */ children,
+      },
+      *family++);
+}
+
+static ShadowNode::Shared buildPlainTree(
+    int depth,
+    std::vector<ShadowNodeFamily::Shared>::const_iterator &family,
+    RawPropsParser const &rawPropsParser) {
+  auto children = std::make_shared<SharedShadowNodeList>();
+  if (depth > 0) {
+    for (int i = 0; i < kFanout; i++) {
+      children->push_back(buildPlainTree(depth - 1, family, rawPropsParser));
+    }
+  }
+
+  RawProps rawProps{treeConstructionPropsDynamic};
+  rawProps.parse(rawPropsParser);
+  auto props = std::make_shared<ViewProps const>(
+      *ViewShadowNode::defaultSharedProps(), rawProps);
+
+  return std::make_shared<ViewShadowNode>(
+      ShadowNodeFragment{
+          /* .props = */ props,
+          /* .children = */ children,
+      },
+      *family++,
+      ViewShadowNode::BaseTraits());
+}
+
+static void treeConstructionPooled(benchmark::State &state) {
+  auto depth = static_cast<int>(state.range(0));
+  auto families = createFamilies(countNodes(depth));
+
+  for (auto _ : state) {
+    auto family = families.cbegin();
+    benchmark::DoNotOptimize(buildPooledTree(depth, family));
+  }
+  state.SetItemsProcessed(state.iterations() * families.size());
+}
+BENCHMARK(treeConstructionPooled)->Arg(2)->Arg(3)->Arg(4);
+
+static void treeConstructionPlain(benchmark::State &state) {
+  auto depth = static_cast<int>(state.range(0));
+  auto families = createFamilies(countNodes(depth));
+  auto rawPropsParser = RawPropsParser{};
+  rawPropsParser.prepare<ViewProps>();
+
+  for (auto _ : state) {
+    auto family = families.cbegin();
+    benchmark::DoNotOptimize(buildPlainTree(depth, family, rawPropsParser));
+  }
+  state.SetItemsProcessed(state.iterations() * families.size());
+}
+BENCHMARK(treeConstructionPlain)->Arg(2)->Arg(3)->Arg(4);
+
+} // namespace react
+} // namespace facebook
@@ -7,6 +7,7 @@
 
 #include "Transform.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace facebook {
@@ -99,54 +100,85 @@ bool Transform::operator!=(Transform const &rhs) const {
   return !(*this == rhs);
 }
 
+/*
+ * Computes `rhs * lhs` in terms of `at(i, j)` (which is how transforms are
+ * concatenated). Every row of the result is a combination of rows of `lhs`
+ * with coefficients from the corresponding row of `rhs`; written this way, the
+ * inner loop compiles to 4-wide vector operations (SSE, NEON).
+ */
+static void multiplyFull(
+    std::array<Float, 16> const &lhs,
+    std::array<Float, 16> const &rhs,
+    std::array<Float, 16> &result) {
+  for (auto i = 0; i < 4; i++) {
+    Float row[4] = {0, 0, 0, 0};
+    for (auto k = 0; k < 4; k++) {
+      auto coefficient = rhs[i * 4 + k];
+      for (auto j = 0; j < 4; j++) {
+        row[j] += coefficient * lhs[k * 4 + j];
+      }
+    }
+    for (auto j = 0; j < 4; j++) {
+      result[i * 4 + j] = row[j];
+    }
+  }
+}
+
+Transform::Kind Transform::getKind() const {
+  auto const &m = matrix;
+
+  if (m[2] != 0 || m[3] != 0 || m[6] != 0 || m[7] != 0 || m[8] != 0 ||
+      m[9] != 0 || m[10] != 1 || m[11] != 0 || m[14] != 0 || m[15] != 1) {
+    return Kind::Full;
+  }
+
+  if (m[0] != 1 || m[1] != 0 || m[4] != 0 || m[5] != 1) {
+    return Kind::Affine2D;
+  }
+
+  if (m[12] != 0 || m[13] != 0) {
+    return Kind::Translate;
+  }
+
+  return Kind::Identity;
+}
+
 Transform Transform::operator*(Transform const &rhs) const {
-  if (*this == Transform::Identity()) {
+  auto const &lhs = *this;
+  auto lhsKind = lhs.getKind();
+  auto rhsKind = rhs.getKind();
+
+  if (lhsKind == Kind::Identity) {
     return rhs;
   }
 
-  const auto &lhs = *this;
-  auto result = Transform{};
+  if (rhsKind == Kind::Identity) {
+    return lhs;
+  }
 
-  auto lhs00 = lhs.matrix[0], lhs01 = lhs.matrix[1], lhs02 = lhs.matrix[2],
-       lhs03 = lhs.matrix[3], lhs10 = lhs.matrix[4], lhs11 = lhs.matrix[5],
-       lhs12 = lhs.matrix[6], lhs13 = lhs.matrix[7], lhs20 = lhs.matrix[8],
-       lhs21 = lhs.matrix[9], lhs22 = lhs.matrix[10], lhs23 = lhs.matrix[11],
-       lhs30 = lhs.matrix[12], lhs31 = lhs.matrix[13], lhs32 = lhs.matrix[14],
-       lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0], rhs1 = rhs.matrix[1], rhs2 = rhs.matrix[2],
-       rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
+  auto const &l = lhs.matrix;
+  auto const &r = rhs.matrix;
+  auto result = Transform{};
+  auto &m = result.matrix;
+
+  switch (std::max(lhsKind, rhsKind)) {
+    case Kind::Identity:
+    case Kind::Translate:
+      m[12] = l[12] + r[12];
+      m[13] = l[13] + r[13];
+      break;
+    case Kind::Affine2D:
+      m[0] = r[0] * l[0] + r[1] * l[4];
+      m[1] = r[0] * l[1] + r[1] * l[5];
+      m[4] = r[4] * l[0] + r[5] * l[4];
+      m[5] = r[4] * l[1] + r[5] * l[5];
+      m[12] = r[12] * l[0] + r[13] * l[4] + l[12];
+      m[13] = r[12] * l[1] + r[13] * l[5] + l[13];
+      break;
+    case Kind::Full:
+      multiplyFull(l, r, m);
+      break;
+  }
 
   return result;
 }
@@ -160,8 +192,18 @@ Float const &Transform::at(int i, int j) const {
 }
 
 Point operator*(Point const &point, Transform const &transform) {
-  if (transform == Transform::Identity()) {
-    return point;
+  auto const &m = transform.matrix;
+
+  switch (transform.getKind()) {
+    case Transform::Kind::Identity:
+      return point;
+    case Transform::Kind::Translate:
+      return {point.x + m[12], point.y + m[13]};
+    case Transform::Kind::Affine2D:
+      return {point.x * m[0] + point.y * m[4] + m[12],
+              point.x * m[1] + point.y * m[5] + m[13]};
+    case Transform::Kind::Full:
+      break;
   }
 
   auto result = transform * Vector{point.x, point.y, 0, 1};
@@ -170,6 +212,29 @@ Point operator*(Point const &point, Transform const &transform) {
 }
 
 Rect operator*(Rect const &rect, Transform const &transform) {
+  auto const &m = transform.matrix;
+
+  switch (transform.getKind()) {
+    case Transform::Kind::Identity:
+      return rect;
+    case Transform::Kind::Translate:
+      return {{rect.origin.x + m[12], rect.origin.y + m[13]}, rect.size};
+    case Transform::Kind::Affine2D: {
+      // The rect is transformed around its center, so the center only moves
+      // by the translation and the size of the bounding rect depends only on
+      // the linear part of the transform.
+      auto centre = rect.getCenter();
+      auto width = std::abs(rect.size.width * m[0]) +
+          std::abs(rect.size.height * m[4]);
+      auto height = std::abs(rect.size.width * m[1]) +
+          std::abs(rect.size.height * m[5]);
+      return {{centre.x + m[12] - width / 2, centre.y + m[13] - height / 2},
+              {width, height}};
+    }
+    case Transform::Kind::Full:
+      break;
+  }
+
   auto centre = rect.getCenter();
 
   auto a = Point{rect.origin.x, rect.origin.y} - centre;
@@ -205,7 +270,7 @@ Vector operator*(Transform const &transform, Vector const &vector) {
 }
 
 Size operator*(Size const &size, Transform const &transform) {
-  if (transform == Transform::Identity()) {
+  if (transform.getKind() == Transform::Kind::Identity) {
     return size;
   }
 
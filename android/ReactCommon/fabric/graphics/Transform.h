@@ -20,6 +20,18 @@ namespace react {
  * Defines transform matrix to apply affine transformations.
  */
 struct Transform {
+  /*
+   * Describes the simplest form a transform matrix has; each kind is a
+   * special case of the following ones. Operations on transforms of simpler
+   * kinds are implemented with fewer arithmetic operations.
+   */
+  enum class Kind {
+    Identity,
+    Translate, // Translation along the X and Y axes only.
+    Affine2D, // Scale, skew, rotation around the Z axis and translation.
+    Full,
+  };
+
   std::array<Float, 16> matrix{
       {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
 
@@ -56,6 +68,13 @@ struct Transform {
   static Transform RotateZ(Float angle);
   static Transform Rotate(Float angleX, Float angleY, Float angleZ);
 
+  /*
+   * Returns the kind of the transform.
+   * The kind is derived from the matrix (which can be changed directly), the
+   * computation is cheaper than a comparison of two transforms.
+   */
+  Kind getKind() const;
+
   /*
    * Equality operators.
    */
@@ -85,8 +104,9 @@ Point operator*(Point const &point, Transform const &transform);
 Size operator*(Size const &size, Transform const &transform);
 
 /*
- * Applies tranformation to the given rect.
- * ONLY SUPPORTS scale and translation transformation.
+ * Applies tranformation to the given rect (around its center).
+ * Returns the bounding rect of the transformed one; the perspective component
+ * of the transform is ignored.
  */
 Rect operator*(Rect const &rect, Transform const &transform);
 
@@ -66,3 +66,66 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, kinds) {
+  EXPECT_EQ(Transform::Identity().getKind(), Transform::Kind::Identity);
+  EXPECT_EQ(
+      Transform::Translate(1, 2, 0).getKind(), Transform::Kind::Translate);
+  EXPECT_EQ(Transform::Scale(2, 2, 1).getKind(), Transform::Kind::Affine2D);
+  EXPECT_EQ(Transform::RotateZ(1).getKind(), Transform::Kind::Affine2D);
+  EXPECT_EQ(Transform::Skew(1, 0).getKind(), Transform::Kind::Affine2D);
+  EXPECT_EQ(Transform::Translate(1, 2, 3).getKind(), Transform::Kind::Full);
+  EXPECT_EQ(Transform::RotateX(1).getKind(), Transform::Kind::Full);
+  EXPECT_EQ(Transform::Perspective(42).getKind(), Transform::Kind::Full);
+}
+
+TEST(TransformTest, concatenatingTransformsOfDifferentKinds) {
+  auto translate = Transform::Translate(10, 20, 0);
+  auto scale = Transform::Scale(2, 3, 1);
+  auto rotate = Transform::RotateZ(M_PI_4);
+
+  auto translated = translate * Transform::Translate(1, 2, 0);
+  EXPECT_EQ(translated, Transform::Translate(11, 22, 0));
+
+  // Concatenation applies the right-hand transform first.
+  auto point = facebook::react::Point{1, 1};
+  auto scaledAndTranslated = point * (translate * scale);
+  EXPECT_EQ(scaledAndTranslated.x, 12);
+  EXPECT_EQ(scaledAndTranslated.y, 23);
+
+  auto expected = point * rotate * scale * translate;
+  auto concatenated = point * (translate * scale * rotate);
+  ASSERT_NEAR(concatenated.x, expected.x, 0.0001);
+  ASSERT_NEAR(concatenated.y, expected.y, 0.0001);
+
+  // Z-scale makes the transform a full one but does not affect points on
+  // the XY plane.
+  auto full = translate * scale * rotate * Transform::Scale(1, 1, 2);
+  EXPECT_EQ(full.getKind(), Transform::Kind::Full);
+  auto concatenatedFull = point * full;
+  ASSERT_NEAR(concatenatedFull.x, expected.x, 0.0001);
+  ASSERT_NEAR(concatenatedFull.y, expected.y, 0.0001);
+}
+
+TEST(TransformTest, transformingRectWithAffineTransform) {
+  auto rect = facebook::react::Rect{{10, 20}, {30, 40}};
+  auto affine = Transform::Translate(5, 6, 0) * Transform::Scale(2, -1, 1) *
+      Transform::RotateZ(0.3);
+  auto full = affine * Transform::Scale(1, 1, 2);
+
+  EXPECT_EQ(affine.getKind(), Transform::Kind::Affine2D);
+  EXPECT_EQ(full.getKind(), Transform::Kind::Full);
+
+  auto affineRect = rect * affine;
+  auto fullRect = rect * full;
+  ASSERT_NEAR(affineRect.origin.x, fullRect.origin.x, 0.0001);
+  ASSERT_NEAR(affineRect.origin.y, fullRect.origin.y, 0.0001);
+  ASSERT_NEAR(affineRect.size.width, fullRect.size.width, 0.0001);
+  ASSERT_NEAR(affineRect.size.height, fullRect.size.height, 0.0001);
+
+  auto translatedRect = rect * Transform::Translate(5, 6, 0);
+  EXPECT_EQ(translatedRect.origin.x, 15);
+  EXPECT_EQ(translatedRect.origin.y, 26);
+  EXPECT_EQ(translatedRect.size.width, 30);
+  EXPECT_EQ(translatedRect.size.height, 40);
+}
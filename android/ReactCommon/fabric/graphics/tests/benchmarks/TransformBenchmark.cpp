@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/graphics/Transform.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Measures concatenation of transforms and mapping of rects through them
+ * (what `getRelativeLayoutMetrics` does for every ancestor) for transforms
+ * of every kind.
+ */
+
+static Transform transformOfKind(Transform::Kind kind) {
+  switch (kind) {
+    case Transform::Kind::Identity:
+      return Transform::Identity();
+    case Transform::Kind::Translate:
+      return Transform::Translate(10, 20, 0);
+    case Transform::Kind::Affine2D:
+      return Transform::Scale(1.5, 0.5, 1) * Transform::RotateZ(0.3);
+    case Transform::Kind::Full:
+      return Transform::Perspective(1000) * Transform::RotateX(0.3);
+  }
+  return Transform::Identity();
+}
+
+static void concatenateTransforms(benchmark::State &state) {
+  auto kind = static_cast<Transform::Kind>(state.range(0));
+  auto lhs = transformOfKind(kind);
+  auto rhs = transformOfKind(kind);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs);
+    benchmark::DoNotOptimize(rhs);
+    benchmark::DoNotOptimize(lhs * rhs);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(concatenateTransforms)->DenseRange(0, 3);
+
+static void transformRect(benchmark::State &state) {
+  auto kind = static_cast<Transform::Kind>(state.range(0));
+  auto transform = transformOfKind(kind);
+  auto rect = Rect{{10, 20}, {300, 400}};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect);
+    benchmark::DoNotOptimize(transform);
+    benchmark::DoNotOptimize(rect * transform);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(transformRect)->DenseRange(0, 3);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -32,6 +32,15 @@ class ImageRequest final {
       const ImageSource &imageSource,
       std::shared_ptr<const ImageInstrumentation> instrumentation);
 
+  /*
+   * Constructs a request which shares the given coordinator (and hence the
+   * response) with other requests for the same image.
+   */
+  ImageRequest(
+      const ImageSource &imageSource,
+      std::shared_ptr<const ImageInstrumentation> instrumentation,
+      std::shared_ptr<const ImageResponseObserverCoordinator> coordinator);
+
   /*
    * The move constructor.
    */
@@ -49,6 +58,22 @@ class ImageRequest final {
    */
   void setCancelationFunction(std::function<void(void)> cancelationFunction);
 
+  /*
+   * Set function which is called with `true` when a view showing the image
+   * starts to be visible and with `false` when it stops (or when the request
+   * is destroyed while the view is visible).
+   */
+  void setVisibilityFunction(std::function<void(bool)> visibilityFunction);
+
+  /*
+   * Call these when the view showing the image starts and stops to be visible
+   * on screen. Reports the change to the image instrumentation (if any) and to
+   * the image loader (see `setVisibilityFunction`), which may prioritize the
+   * request. Must be called from the main thread.
+   */
+  void didEnterVisibilityRange() const;
+  void didExitVisibilityRange() const;
+
   /*
    * Returns stored observer coordinator as a shared pointer.
    * Retain this *or* `ImageRequest` to ensure a correct lifetime of the object.
@@ -98,6 +123,17 @@ class ImageRequest final {
    */
   std::function<void(void)> cancelRequest_;
 
+  /*
+   * Function we can call to report visibility changes of the view showing the
+   * image.
+   */
+  std::function<void(bool)> reportVisibility_;
+
+  /*
+   * Indicates that the view showing the image is visible.
+   */
+  mutable bool visible_{false};
+
   /*
    * Indicates that the object was moved and hence cannot be used anymore.
    */
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageRequestPool.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include <folly/Hash.h>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+/*
+ * Unlike `ImageSource::operator==`, takes into account everything that
+ * affects the loaded image.
+ */
+struct ImageSourceHash {
+  size_t operator()(ImageSource const &imageSource) const {
+    return folly::hash::hash_combine(
+        0,
+        static_cast<int>(imageSource.type),
+        imageSource.uri,
+        imageSource.bundle,
+        imageSource.scale,
+        imageSource.size.width,
+        imageSource.size.height);
+  }
+};
+
+struct ImageSourceEqual {
+  bool operator()(ImageSource const &lhs, ImageSource const &rhs) const {
+    return std::tie(lhs.type, lhs.uri, lhs.bundle, lhs.scale) ==
+        std::tie(rhs.type, rhs.uri, rhs.bundle, rhs.scale) &&
+        lhs.size == rhs.size;
+  }
+};
+
+} // namespace
+
+struct ImageRequestPool::State {
+  std::mutex mutex;
+  std::unordered_map<
+      ImageSource,
+      std::weak_ptr<Entry>,
+      ImageSourceHash,
+      ImageSourceEqual>
+      entries;
+  Counters counters;
+};
+
+/*
+ * Shared by all `ImageRequest`s for the same source; the last one which is
+ * destroyed cancels the platform request.
+ */
+struct ImageRequestPool::Entry {
+  Entry(ImageSource imageSource, std::weak_ptr<State> state)
+      : imageSource(std::move(imageSource)), state(std::move(state)) {}
+
+  ~Entry() {
+    auto state = this->state.lock();
+    if (!state) {
+      return;
+    }
+
+    auto cancel = std::function<void()>{};
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+
+      // A new entry for the same source might have been created already.
+      auto iterator = state->entries.find(imageSource);
+      if (iterator != state->entries.end() && iterator->second.expired()) {
+        state->entries.erase(iterator);
+      }
+
+      if (coordinator->getStatus() == ImageResponse::Status::Loading) {
+        state->counters.cancellations++;
+        cancel = loading.cancel;
+      }
+    }
+
+    if (cancel) {
+      cancel();
+    }
+  }
+
+  ImageSource const imageSource;
+  std::weak_ptr<State> const state;
+  std::shared_ptr<ImageResponseObserverCoordinator const> const coordinator{
+      std::make_shared<ImageResponseObserverCoordinator const>()};
+
+  /*
+   * Protected by `State::mutex`.
+   */
+  Loading loading{};
+  int visibleCount{0};
+};
+
+ImageRequestPool::ImageRequestPool(LoadFunction load)
+    : load_(std::move(load)), state_(std::make_shared<State>()) {}
+
+ImageRequest ImageRequestPool::requestImage(
+    ImageSource const &imageSource,
+    SurfaceId surfaceId,
+    std::shared_ptr<ImageInstrumentation const> instrumentation) const {
+  auto entry = std::shared_ptr<Entry>{};
+  // Destroying an entry locks the mutex, so a failed entry must be released
+  // after the mutex is unlocked.
+  auto failedEntry = std::shared_ptr<Entry>{};
+  auto shouldLoad = false;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->counters.requests++;
+
+    auto &weakEntry = state_->entries[imageSource];
+    entry = weakEntry.lock();
+
+    auto status =
+        entry ? entry->coordinator->getStatus() : ImageResponse::Status::Failed;
+    switch (status) {
+      case ImageResponse::Status::Completed:
+        state_->counters.hits++;
+        break;
+      case ImageResponse::Status::Loading:
+        state_->counters.deduplications++;
+        break;
+      case ImageResponse::Status::Failed:
+        // The previous entry (if any) stays alive only as long as requests
+        // that share it.
+        failedEntry = std::move(entry);
+        entry = std::make_shared<Entry>(imageSource, state_);
+        weakEntry = entry;
+        state_->counters.loads++;
+        shouldLoad = true;
+        break;
+    }
+  }
+
+  if (shouldLoad) {
+    auto loading = load_(
+        imageSource,
+        surfaceId,
+        Priority::Normal,
+        entry->coordinator,
+        instrumentation);
+
+    auto setPriority = std::function<void(Priority)>{};
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      entry->loading = std::move(loading);
+      // The image might have become visible while the request was starting.
+      if (entry->visibleCount > 0) {
+        setPriority = entry->loading.setPriority;
+      }
+    }
+
+    if (setPriority) {
+      setPriority(Priority::High);
+    }
+  }
+
+  auto imageRequest =
+      ImageRequest(imageSource, instrumentation, entry->coordinator);
+
+  // The request retains the entry; destroying it releases the entry (and
+  // cancels the platform request if it was the last one).
+  imageRequest.setCancelationFunction([entry]() {});
+
+  auto weakState = std::weak_ptr<State>{state_};
+  imageRequest.setVisibilityFunction([entry, weakState](bool visible) {
+    auto state = weakState.lock();
+    if (state) {
+      updateVisibility(*state, *entry, visible ? 1 : -1);
+    }
+  });
+
+  return imageRequest;
+}
+
+void ImageRequestPool::didEnterVisibilityRange(
+    ImageSource const &imageSource) const {
+  updateVisibility(imageSource, 1);
+}
+
+void ImageRequestPool::didExitVisibilityRange(
+    ImageSource const &imageSource) const {
+  updateVisibility(imageSource, -1);
+}
+
+void ImageRequestPool::updateVisibility(
+    ImageSource const &imageSource,
+    int delta) const {
+  // Destroying an entry locks the mutex, so it must be released after the
+  // mutex is unlocked.
+  auto entry = std::shared_ptr<Entry>{};
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+
+    auto iterator = state_->entries.find(imageSource);
+    if (iterator == state_->entries.end()) {
+      return;
+    }
+
+    entry = iterator->second.lock();
+    if (!entry) {
+      return;
+    }
+  }
+
+  updateVisibility(*state_, *entry, delta);
+}
+
+void ImageRequestPool::updateVisibility(State &state, Entry &entry, int delta) {
+  auto setPriority = std::function<void(Priority)>{};
+  auto priority = Priority::Normal;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto wasVisible = entry.visibleCount > 0;
+    entry.visibleCount = std::max(0, entry.visibleCount + delta);
+    auto isVisible = entry.visibleCount > 0;
+
+    if (wasVisible != isVisible) {
+      setPriority = entry.loading.setPriority;
+      priority = isVisible ? Priority::High : Priority::Normal;
+    }
+  }
+
+  if (setPriority) {
+    setPriority(priority);
+  }
+}
+
+ImageRequestPool::Counters ImageRequestPool::getCounters() const {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->counters;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <react/core/ReactPrimitives.h>
+#include <react/imagemanager/ImageInstrumentation.h>
+#include <react/imagemanager/ImageRequest.h>
+#include <react/imagemanager/ImageResponseObserverCoordinator.h>
+#include <react/imagemanager/primitives.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Deduplicates image requests: all `ImageRequest`s for equal image sources
+ * (including size and scale) which exist at the same time share one
+ * `ImageResponseObserverCoordinator` and one platform-specific request.
+ * The platform request is canceled when the last `ImageRequest` for the
+ * source is destroyed (e.g. when all nodes showing the image unmount).
+ * Failed requests are not shared: the next request for the source retries.
+ * All methods are thread-safe.
+ */
+class ImageRequestPool final {
+ public:
+  enum class Priority {
+    Normal,
+    High, // At least one view showing the image is visible.
+  };
+
+  /*
+   * Handles of a started platform-specific request.
+   */
+  struct Loading {
+    std::function<void()> cancel{};
+    std::function<void(Priority priority)> setPriority{};
+  };
+
+  /*
+   * Starts a platform-specific request which reports progress and results
+   * to the given coordinator. `instrumentation` is the one of the request
+   * which started loading (other requests for the same source join it).
+   */
+  using LoadFunction = std::function<Loading(
+      ImageSource const &imageSource,
+      SurfaceId surfaceId,
+      Priority priority,
+      std::shared_ptr<ImageResponseObserverCoordinator const> const
+          &coordinator,
+      std::shared_ptr<ImageInstrumentation const> const &instrumentation)>;
+
+  struct Counters {
+    int requests{0};
+    int loads{0};
+    /*
+     * Requests for images which were already loaded.
+     */
+    int hits{0};
+    /*
+     * Requests which joined a platform request in progress.
+     */
+    int deduplications{0};
+    /*
+     * Platform requests canceled because all requests were destroyed.
+     */
+    int cancellations{0};
+  };
+
+  ImageRequestPool(LoadFunction load);
+
+  ImageRequest requestImage(
+      ImageSource const &imageSource,
+      SurfaceId surfaceId,
+      std::shared_ptr<ImageInstrumentation const> instrumentation) const;
+
+  /*
+   * Call these when a view showing the image starts and stops to be visible
+   * (along with the same `ImageInstrumentation` methods); the platform
+   * request has a `High` priority while any of such views is visible.
+   * Views which retain their `ImageRequest` should call its
+   * `didEnterVisibilityRange` and `didExitVisibilityRange` instead, which
+   * also balance the counts when the request is destroyed.
+   */
+  void didEnterVisibilityRange(ImageSource const &imageSource) const;
+  void didExitVisibilityRange(ImageSource const &imageSource) const;
+
+  Counters getCounters() const;
+
+ private:
+  struct Entry;
+  struct State;
+
+  LoadFunction load_;
+  std::shared_ptr<State> state_;
+
+  void updateVisibility(ImageSource const &imageSource, int delta) const;
+  static void updateVisibility(State &state, Entry &entry, int delta);
+};
+
+} // namespace react
+} // namespace facebook
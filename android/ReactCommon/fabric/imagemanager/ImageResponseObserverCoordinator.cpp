@@ -43,7 +43,7 @@ void ImageResponseObserverCoordinator::removeObserver(
   // We remove only one element to maintain a balance between add/remove calls.
   auto position = std::find(observers_.begin(), observers_.end(), &observer);
   if (position != observers_.end()) {
-    observers_.erase(position, observers_.end());
+    observers_.erase(position);
   }
 }
 
@@ -68,7 +68,7 @@ void ImageResponseObserverCoordinator::nativeImageResponseComplete(
   auto observers = observers_;
   mutex_.unlock();
 
-  for (auto observer : observers_) {
+  for (auto observer : observers) {
     observer->didReceiveImage(imageResponse);
   }
 }
@@ -85,5 +85,10 @@ void ImageResponseObserverCoordinator::nativeImageResponseFailed() const {
   }
 }
 
+ImageResponse::Status ImageResponseObserverCoordinator::getStatus() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return status_;
+}
+
 } // namespace react
 } // namespace facebook
@@ -54,6 +54,11 @@ class ImageResponseObserverCoordinator {
    */
   void nativeImageResponseFailed() const;
 
+  /*
+   * Returns the current status of image loading.
+   */
+  ImageResponse::Status getStatus() const;
+
  private:
   /*
    * List of observers.
@@ -7,24 +7,36 @@
 
 #include "ImageManager.h"
 
+#include <react/imagemanager/ImageRequestPool.h>
+
 namespace facebook {
 namespace react {
 
 ImageManager::ImageManager(ContextContainer::Shared const &contextContainer) {
-  // Silence unused-private-field warning.
-  (void)self_;
-  // Not implemented.
+  // Images are not loaded by this implementation, but requests still go
+  // through the pool, so nodes showing the same image share one request.
+  self_ = new ImageRequestPool(
+      [](ImageSource const &imageSource,
+         SurfaceId surfaceId,
+         ImageRequestPool::Priority priority,
+         std::shared_ptr<ImageResponseObserverCoordinator const> const
+             &coordinator,
+         std::shared_ptr<ImageInstrumentation const> const &instrumentation) {
+        // Not implemented.
+        return ImageRequestPool::Loading{};
+      });
 }
 
 ImageManager::~ImageManager() {
-  // Not implemented.
+  delete static_cast<ImageRequestPool *>(self_);
+  self_ = nullptr;
 }
 
 ImageRequest ImageManager::requestImage(
     const ImageSource &imageSource,
     SurfaceId surfaceId) const {
-  // Not implemented.
-  return ImageRequest(imageSource, nullptr);
+  auto requestPool = static_cast<ImageRequestPool const *>(self_);
+  return requestPool->requestImage(imageSource, surfaceId, nullptr);
 }
 
 } // namespace react
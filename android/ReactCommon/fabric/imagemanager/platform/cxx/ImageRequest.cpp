@@ -10,44 +10,114 @@
 namespace facebook {
 namespace react {
 
+namespace {
+
+class NoopImageInstrumentation final : public ImageInstrumentation {
+ public:
+  void didSetImage() const override {}
+  void didEnterVisibilityRange() const override {}
+  void didExitVisibilityRange() const override {}
+};
+
+} // namespace
+
 ImageRequest::ImageRequest(
     const ImageSource &imageSource,
     std::shared_ptr<const ImageInstrumentation> instrumentation)
     : imageSource_(imageSource), instrumentation_(instrumentation) {
-  // Not implemented.
+  coordinator_ = std::make_shared<ImageResponseObserverCoordinator>();
 }
 
+ImageRequest::ImageRequest(
+    const ImageSource &imageSource,
+    std::shared_ptr<const ImageInstrumentation> instrumentation,
+    std::shared_ptr<const ImageResponseObserverCoordinator> coordinator)
+    : imageSource_(imageSource),
+      coordinator_(std::move(coordinator)),
+      instrumentation_(std::move(instrumentation)) {}
+
 ImageRequest::ImageRequest(ImageRequest &&other) noexcept
     : imageSource_(std::move(other.imageSource_)),
-      coordinator_(std::move(other.coordinator_)) {
-  // Not implemented.
+      coordinator_(std::move(other.coordinator_)),
+      instrumentation_(std::move(other.instrumentation_)),
+      cancelRequest_(std::move(other.cancelRequest_)),
+      reportVisibility_(std::move(other.reportVisibility_)),
+      visible_(other.visible_) {
+  other.moved_ = true;
+  other.coordinator_ = nullptr;
+  other.cancelRequest_ = nullptr;
+  other.reportVisibility_ = nullptr;
+  other.visible_ = false;
+  other.instrumentation_ = nullptr;
 }
 
 ImageRequest::~ImageRequest() {
-  // Not implemented.
+  if (visible_ && reportVisibility_) {
+    reportVisibility_(false);
+  }
+
+  if (cancelRequest_) {
+    cancelRequest_();
+  }
+}
+
+void ImageRequest::setCancelationFunction(
+    std::function<void(void)> cancelationFunction) {
+  cancelRequest_ = cancelationFunction;
+}
+
+void ImageRequest::setVisibilityFunction(
+    std::function<void(bool)> visibilityFunction) {
+  reportVisibility_ = std::move(visibilityFunction);
+}
+
+void ImageRequest::didEnterVisibilityRange() const {
+  if (visible_) {
+    return;
+  }
+
+  visible_ = true;
+  if (instrumentation_) {
+    instrumentation_->didEnterVisibilityRange();
+  }
+  if (reportVisibility_) {
+    reportVisibility_(true);
+  }
+}
+
+void ImageRequest::didExitVisibilityRange() const {
+  if (!visible_) {
+    return;
+  }
+
+  visible_ = false;
+  if (instrumentation_) {
+    instrumentation_->didExitVisibilityRange();
+  }
+  if (reportVisibility_) {
+    reportVisibility_(false);
+  }
 }
 
 const ImageResponseObserverCoordinator &ImageRequest::getObserverCoordinator()
     const {
-  // Not implemented
-  abort();
+  return *coordinator_;
 }
 
 const std::shared_ptr<const ImageResponseObserverCoordinator>
     &ImageRequest::getSharedObserverCoordinator() const {
-  // Not implemented
-  abort();
+  return coordinator_;
 }
 
 const std::shared_ptr<const ImageInstrumentation>
     &ImageRequest::getSharedImageInstrumentation() const {
-  // Not implemented
-  abort();
+  return instrumentation_;
 }
 
 const ImageInstrumentation &ImageRequest::getImageInstrumentation() const {
-  // Not implemented
-  abort();
+  // The cxx `ImageManager` does not instrument its requests.
+  static auto const noopInstrumentation = NoopImageInstrumentation{};
+  return instrumentation_ ? *instrumentation_ : noopInstrumentation;
 }
 
 } // namespace react
@@ -17,17 +17,34 @@ ImageRequest::ImageRequest(
   coordinator_ = std::make_shared<ImageResponseObserverCoordinator>();
 }
 
+ImageRequest::ImageRequest(
+    const ImageSource &imageSource,
+    std::shared_ptr<const ImageInstrumentation> instrumentation,
+    std::shared_ptr<const ImageResponseObserverCoordinator> coordinator)
+    : imageSource_(imageSource),
+      coordinator_(std::move(coordinator)),
+      instrumentation_(std::move(instrumentation)) {}
+
 ImageRequest::ImageRequest(ImageRequest &&other) noexcept
     : imageSource_(std::move(other.imageSource_)),
       coordinator_(std::move(other.coordinator_)),
-      instrumentation_(std::move(other.instrumentation_)) {
+      instrumentation_(std::move(other.instrumentation_)),
+      cancelRequest_(std::move(other.cancelRequest_)),
+      reportVisibility_(std::move(other.reportVisibility_)),
+      visible_(other.visible_) {
   other.moved_ = true;
   other.coordinator_ = nullptr;
   other.cancelRequest_ = nullptr;
+  other.reportVisibility_ = nullptr;
+  other.visible_ = false;
   other.instrumentation_ = nullptr;
 }
 
 ImageRequest::~ImageRequest() {
+  if (visible_ && reportVisibility_) {
+    reportVisibility_(false);
+  }
+
   if (cancelRequest_) {
     cancelRequest_();
   }
@@ -38,6 +55,39 @@ void ImageRequest::setCancelationFunction(
   cancelRequest_ = cancelationFunction;
 }
 
+void ImageRequest::setVisibilityFunction(
+    std::function<void(bool)> visibilityFunction) {
+  reportVisibility_ = std::move(visibilityFunction);
+}
+
+void ImageRequest::didEnterVisibilityRange() const {
+  if (visible_) {
+    return;
+  }
+
+  visible_ = true;
+  if (instrumentation_) {
+    instrumentation_->didEnterVisibilityRange();
+  }
+  if (reportVisibility_) {
+    reportVisibility_(true);
+  }
+}
+
+void ImageRequest::didExitVisibilityRange() const {
+  if (!visible_) {
+    return;
+  }
+
+  visible_ = false;
+  if (instrumentation_) {
+    instrumentation_->didExitVisibilityRange();
+  }
+  if (reportVisibility_) {
+    reportVisibility_(false);
+  }
+}
+
 const ImageResponseObserverCoordinator &ImageRequest::getObserverCoordinator()
     const {
   return *coordinator_;
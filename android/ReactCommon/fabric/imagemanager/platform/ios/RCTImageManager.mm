@@ -13,6 +13,7 @@
 
 #import <React/RCTImageLoaderWithAttributionProtocol.h>
 
+#import <react/imagemanager/ImageRequestPool.h>
 #import <react/imagemanager/ImageResponse.h>
 #import <react/imagemanager/ImageResponseObserver.h>
 
@@ -24,6 +25,7 @@ using namespace facebook::react;
 @implementation RCTImageManager {
   id<RCTImageLoaderWithAttributionProtocol> _imageLoader;
   dispatch_queue_t _backgroundSerialQueue;
+  std::shared_ptr<ImageRequestPool> _requestPool;
 }
 
 - (instancetype)initWithImageLoader:(id<RCTImageLoaderWithAttributionProtocol>)imageLoader
@@ -32,6 +34,29 @@ using namespace facebook::react;
     _imageLoader = imageLoader;
     _backgroundSerialQueue =
         dispatch_queue_create("com.facebook.react-native.image-manager-queue", DISPATCH_QUEUE_SERIAL);
+
+    __weak RCTImageManager *weakSelf = self;
+    _requestPool = std::make_shared<ImageRequestPool>(
+        [weakSelf](
+            ImageSource const &imageSource,
+            SurfaceId surfaceId,
+            ImageRequestPool::Priority priority,
+            std::shared_ptr<ImageResponseObserverCoordinator const> const &observerCoordinator,
+            std::shared_ptr<ImageInstrumentation const> const &imageInstrumentation) {
+          // `RCTImageLoader` does not support priorities, so `setPriority` is left empty.
+          auto loading = ImageRequestPool::Loading{};
+          RCTImageManager *strongSelf = weakSelf;
+          if (strongSelf) {
+            // All instrumentation objects are created by `requestImage:surfaceId:`.
+            loading.cancel = [strongSelf loadImage:imageSource
+                                         surfaceId:surfaceId
+                               observerCoordinator:observerCoordinator
+                              imageInstrumentation:std::static_pointer_cast<RCTImageInstrumentationProxy>(
+                                                       std::const_pointer_cast<ImageInstrumentation>(
+                                                           imageInstrumentation))];
+          }
+          return loading;
+        });
   }
 
   return self;
@@ -42,12 +67,19 @@ using namespace facebook::react;
   SystraceSection s("RCTImageManager::requestImage");
 
   auto imageInstrumentation = std::make_shared<RCTImageInstrumentationProxy>(_imageLoader);
-  auto imageRequest = ImageRequest(imageSource, imageInstrumentation);
-  auto weakObserverCoordinator =
-      (std::weak_ptr<const ImageResponseObserverCoordinator>)imageRequest.getSharedObserverCoordinator();
+
+  // Requests for the same image share one `RCTImageLoader` request.
+  return _requestPool->requestImage(imageSource, surfaceId, imageInstrumentation);
+}
+
+- (std::function<void()>)loadImage:(ImageSource)imageSource
+                         surfaceId:(SurfaceId)surfaceId
+               observerCoordinator:(std::shared_ptr<ImageResponseObserverCoordinator const>)observerCoordinator
+              imageInstrumentation:(std::shared_ptr<RCTImageInstrumentationProxy>)imageInstrumentation
+{
+  auto weakObserverCoordinator = (std::weak_ptr<const ImageResponseObserverCoordinator>)observerCoordinator;
 
   auto sharedCancelationFunction = SharedFunction<>();
-  imageRequest.setCancelationFunction(sharedCancelationFunction);
 
   /*
    * Even if an image is being loaded asynchronously on some other background thread, some other preparation
@@ -104,7 +136,7 @@ using namespace facebook::react;
     }
   });
 
-  return imageRequest;
+  return sharedCancelationFunction;
 }
 
 @end
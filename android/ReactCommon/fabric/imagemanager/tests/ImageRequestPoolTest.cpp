@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/imagemanager/ImageRequestPool.h>
+
+using namespace facebook::react;
+
+namespace {
+
+struct LoadRecord {
+  ImageSource imageSource;
+  ImageRequestPool::Priority priority;
+  std::shared_ptr<ImageResponseObserverCoordinator const> coordinator;
+  bool canceled{false};
+};
+
+class CountingImageResponseObserver : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(float progress) const override {}
+
+  void didReceiveImage(ImageResponse const &imageResponse) const override {
+    numberOfImages++;
+  }
+
+  void didReceiveFailure() const override {}
+
+  mutable int numberOfImages{0};
+};
+
+class ImageRequestPoolTest : public ::testing::Test {
+ protected:
+  ImageRequestPool pool_{[this](
+                             ImageSource const &imageSource,
+                             SurfaceId surfaceId,
+                             ImageRequestPool::Priority priority,
+                             std::shared_ptr<
+                                 ImageResponseObserverCoordinator const> const
+                                 &coordinator,
+                             std::shared_ptr<ImageInstrumentation const> const
+                                 &instrumentation) {
+    auto record = std::make_shared<LoadRecord>(
+        LoadRecord{imageSource, priority, coordinator});
+    loads_.push_back(record);
+
+    auto loading = ImageRequestPool::Loading{};
+    loading.cancel = [record]() { record->canceled = true; };
+    loading.setPriority = [record](ImageRequestPool::Priority priority) {
+      record->priority = priority;
+    };
+    return loading;
+  }};
+
+  std::vector<std::shared_ptr<LoadRecord>> loads_;
+
+  static ImageSource makeImageSource(std::string const &uri) {
+    auto imageSource = ImageSource{};
+    imageSource.type = ImageSource::Type::Remote;
+    imageSource.uri = uri;
+    imageSource.size = {100, 100};
+    return imageSource;
+  }
+};
+
+} // namespace
+
+TEST_F(ImageRequestPoolTest, deduplicatesRequests) {
+  auto avatar = makeImageSource("https://example.com/avatar.png");
+
+  auto first = pool_.requestImage(avatar, 1, nullptr);
+  auto second = pool_.requestImage(avatar, 1, nullptr);
+  auto other =
+      pool_.requestImage(makeImageSource("https://example.com/a.png"), 1, {});
+
+  EXPECT_EQ(loads_.size(), 2);
+  EXPECT_EQ(
+      first.getSharedObserverCoordinator(),
+      second.getSharedObserverCoordinator());
+  EXPECT_NE(
+      first.getSharedObserverCoordinator(),
+      other.getSharedObserverCoordinator());
+
+  // The same image of a different size is a different request.
+  auto largeAvatar = avatar;
+  largeAvatar.size = {200, 200};
+  auto large = pool_.requestImage(largeAvatar, 1, nullptr);
+  EXPECT_EQ(loads_.size(), 3);
+
+  auto counters = pool_.getCounters();
+  EXPECT_EQ(counters.requests, 4);
+  EXPECT_EQ(counters.loads, 3);
+  EXPECT_EQ(counters.deduplications, 1);
+}
+
+TEST_F(ImageRequestPoolTest, reusesLoadedImages) {
+  auto avatar = makeImageSource("https://example.com/avatar.png");
+
+  auto first = pool_.requestImage(avatar, 1, nullptr);
+  loads_[0]->coordinator->nativeImageResponseComplete(
+      ImageResponse{std::make_shared<int>(42)});
+
+  auto second = pool_.requestImage(avatar, 1, nullptr);
+  EXPECT_EQ(loads_.size(), 1);
+  EXPECT_EQ(
+      second.getObserverCoordinator().getStatus(),
+      ImageResponse::Status::Completed);
+  EXPECT_EQ(pool_.getCounters().hits, 1);
+}
+
+TEST_F(ImageRequestPoolTest, retriesFailedRequests) {
+  auto avatar = makeImageSource("https://example.com/avatar.png");
+
+  auto first = pool_.requestImage(avatar, 1, nullptr);
+  loads_[0]->coordinator->nativeImageResponseFailed();
+
+  auto second = pool_.requestImage(avatar, 1, nullptr);
+  EXPECT_EQ(loads_.size(), 2);
+  EXPECT_EQ(
+      second.getObserverCoordinator().getStatus(),
+      ImageResponse::Status::Loading);
+}
+
+TEST_F(ImageRequestPoolTest, cancelsWhenLastRequestIsDestroyed) {
+  auto avatar = makeImageSource("https://example.com/avatar.png");
+
+  {
+    auto first = std::make_unique<ImageRequest>(
+        pool_.requestImage(avatar, 1, nullptr));
+    auto second = pool_.requestImage(avatar, 1, nullptr);
+
+    first.reset();
+    EXPECT_FALSE(loads_[0]->canceled);
+  }
+
+  EXPECT_TRUE(loads_[0]->canceled);
+  EXPECT_EQ(pool_.getCounters().cancellations, 1);
+
+  // Completed requests are not canceled.
+  {
+    auto request = pool_.requestImage(avatar, 1, nullptr);
+    EXPECT_EQ(loads_.size(), 2);
+    loads_[1]->coordinator->nativeImageResponseComplete(
+        ImageResponse{std::make_shared<int>(42)});
+  }
+
+  EXPECT_FALSE(loads_[1]->canceled);
+  EXPECT_EQ(pool_.getCounters().cancellations, 1);
+}
+
+TEST_F(ImageRequestPoolTest, prioritizesVisibleImages) {
+  auto avatar = makeImageSource("https://example.com/avatar.png");
+
+  auto first = pool_.requestImage(avatar, 1, nullptr);
+  auto second = pool_.requestImage(avatar, 1, nullptr);
+  EXPECT_EQ(loads_[0]->priority, ImageRequestPool::Priority::Normal);
+
+  pool_.didEnterVisibilityRange(avatar);
+  pool_.didEnterVisibilityRange(avatar);
+  EXPECT_EQ(loads_[0]->priority, ImageRequestPool::Priority::High);
+
+  pool_.didExitVisibilityRange(avatar);
+  EXPECT_EQ(loads_[0]->priority, ImageRequestPool::Priority::High);
+
+  pool_.didExitVisibilityRange(avatar);
+  EXPECT_EQ(loads_[0]->priority, ImageRequestPool::Priority::Normal);
+}
+
+TEST_F(ImageRequestPoolTest, tracksVisibilityOfRequests) {
+  auto avatar = makeImageSource("https://example.com/avatar.png");
+
+  auto first = std::make_unique<ImageRequest>(
+      pool_.requestImage(avatar, 1, nullptr));
+  auto second = pool_.requestImage(avatar, 1, nullptr);
+
+  // Repeated reports of the same view are counted once.
+  first->didEnterVisibilityRange();
+  first->didEnterVisibilityRange();
+  EXPECT_EQ(loads_[0]->priority, ImageRequestPool::Priority::High);
+
+  second.didEnterVisibilityRange();
+  second.didExitVisibilityRange();
+  EXPECT_EQ(loads_[0]->priority, ImageRequestPool::Priority::High);
+
+  // A request destroyed while its view is visible stops counting.
+  first.reset();
+  EXPECT_EQ(loads_[0]->priority, ImageRequestPool::Priority::Normal);
+  EXPECT_FALSE(loads_[0]->canceled);
+}
+
+TEST_F(ImageRequestPoolTest, notifiesRemainingObserversOfSharedLoad) {
+  auto avatar = makeImageSource("https://example.com/avatar.png");
+
+  auto requests = std::vector<ImageRequest>{};
+  auto observers = std::vector<CountingImageResponseObserver>(4);
+  for (auto const &observer : observers) {
+    requests.push_back(pool_.requestImage(avatar, 1, nullptr));
+    requests.back().getObserverCoordinator().addObserver(observer);
+  }
+  EXPECT_EQ(loads_.size(), 1);
+
+  // One of the views goes away (e.g. its row is recycled) before the image
+  // arrives; only its own observer is removed.
+  requests[1].getObserverCoordinator().removeObserver(observers[1]);
+
+  loads_[0]->coordinator->nativeImageResponseComplete(
+      ImageResponse{std::make_shared<int>(42)});
+  EXPECT_EQ(observers[0].numberOfImages, 1);
+  EXPECT_EQ(observers[1].numberOfImages, 0);
+  EXPECT_EQ(observers[2].numberOfImages, 1);
+  EXPECT_EQ(observers[3].numberOfImages, 1);
+}
@@ -15,12 +15,16 @@
 #include <condition_variable>
 
 #include <react/mounting/ShadowViewMutation.h>
+#include <react/mounting/ShadowViewMutationCompaction.h>
 
 namespace facebook {
 namespace react {
 
-MountingCoordinator::MountingCoordinator(ShadowTreeRevision baseRevision)
+MountingCoordinator::MountingCoordinator(
+    ShadowTreeRevision baseRevision,
+    BackgroundExecutor backgroundExecutor)
     : surfaceId_(baseRevision.getRootShadowNode().getSurfaceId()),
+      backgroundExecutor_(std::move(backgroundExecutor)),
       baseRevision_(baseRevision) {
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   stubViewTree_ = stubViewTreeFromShadowNode(baseRevision_.getRootShadowNode());
@@ -32,6 +36,8 @@ SurfaceId MountingCoordinator::getSurfaceId() const {
 }
 
 void MountingCoordinator::push(ShadowTreeRevision &&revision) const {
+  auto shouldSchedulePrecomputation = false;
+
   {
     std::lock_guard<std::mutex> lock(mutex_);
 
@@ -43,20 +49,115 @@ void MountingCoordinator::push(ShadowTreeRevision &&revision) const {
     if (!lastRevision_.has_value() ||
         lastRevision_->getNumber() < revision.getNumber()) {
       lastRevision_ = std::move(revision);
+
+      if (precomputedMutations_.has_value()) {
+        precomputationStatistics_.wasted++;
+        precomputedMutations_.reset();
+      }
+
+      // If a precomputation is scheduled but has not started yet, it will
+      // pick up the new revision.
+      if (backgroundExecutor_ && !isPrecomputationScheduled_) {
+        isPrecomputationScheduled_ = true;
+        shouldSchedulePrecomputation = true;
+      }
+    }
+  }
+
+  if (shouldSchedulePrecomputation) {
+    schedulePrecomputation();
+  }
+
+  signal_.notify_all();
+}
+
+void MountingCoordinator::schedulePrecomputation() const {
+  auto weakThis = std::weak_ptr<MountingCoordinator const>{shared_from_this()};
+  backgroundExecutor_([weakThis]() {
+    auto strongThis = weakThis.lock();
+    if (strongThis) {
+      strongThis->precompute();
+    }
+  });
+}
+
+void MountingCoordinator::precompute() const {
+  better::optional<ShadowTreeRevision> baseRevision;
+  better::optional<ShadowTreeRevision> lastRevision;
+  auto differentiatorMode = DifferentiatorMode{};
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isPrecomputationScheduled_ = false;
+
+    if (!lastRevision_.has_value() || !baseRevision_.rootShadowNode_ ||
+        precomputedMutations_.has_value()) {
+      // Revoked, pulled, or already precomputed by a concurrent task.
+      return;
+    }
+
+    baseRevision = baseRevision_;
+    lastRevision = lastRevision_;
+    differentiatorMode = differentiatorMode_;
+    precomputingRevisionNumber_ = lastRevision->getNumber();
+    numberOfRunningPrecomputations_++;
+  }
+
+  auto telemetry = lastRevision->getTelemetry();
+  telemetry.willDiff();
+
+  auto mutations = calculateShadowViewMutations(
+      differentiatorMode,
+      baseRevision->getRootShadowNode(),
+      lastRevision->getRootShadowNode());
+
+  auto numberOfMutationsBeforeCompaction = (int)mutations.size();
+  compactShadowViewMutations(mutations);
+
+  telemetry.didDiff();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    numberOfRunningPrecomputations_--;
+    if (precomputingRevisionNumber_ == lastRevision->getNumber()) {
+      precomputingRevisionNumber_.reset();
+    }
+
+    if (lastRevision_.has_value() &&
+        lastRevision_->getNumber() == lastRevision->getNumber() &&
+        !precomputedMutations_.has_value()) {
+      precomputedMutations_ =
+          PrecomputedMutations{lastRevision->getNumber(),
+                               differentiatorMode,
+                               std::move(mutations),
+                               numberOfMutationsBeforeCompaction,
+                               telemetry};
+    } else {
+      precomputationStatistics_.wasted++;
     }
+
+    // Releasing the revisions (and their shadow nodes) before `revoke` can
+    // return.
+    baseRevision.reset();
+    lastRevision.reset();
   }
 
   signal_.notify_all();
 }
 
 void MountingCoordinator::revoke() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::unique_lock<std::mutex> lock(mutex_);
   // We have two goals here.
   // 1. We need to stop retaining `ShadowNode`s to not prolong their lifetime
   // to prevent them from overliving `ComponentDescriptor`s.
   // 2. A possible call to `pullTransaction()` should return empty optional.
   baseRevision_.rootShadowNode_.reset();
   lastRevision_.reset();
+  precomputedMutations_.reset();
+
+  // Running precomputations retain `ShadowNode`s as well.
+  signal_.wait(lock, [this]() { return numberOfRunningPrecomputations_ == 0; });
 }
 
 bool MountingCoordinator::waitForTransaction(
@@ -66,25 +167,73 @@ bool MountingCoordinator::waitForTransaction(
       lock, timeout, [this]() { return lastRevision_.has_value(); });
 }
 
+MountingCoordinator::PrecomputationStatistics
+MountingCoordinator::getPrecomputationStatistics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return precomputationStatistics_;
+}
+
 better::optional<MountingTransaction> MountingCoordinator::pullTransaction(
     DifferentiatorMode differentiatorMode) const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::unique_lock<std::mutex> lock(mutex_);
 
   if (!lastRevision_.has_value()) {
     return {};
   }
 
+  differentiatorMode_ = differentiatorMode;
+
+  if (backgroundExecutor_) {
+    // Finishing the precomputation of the last revision is never slower than
+    // starting over.
+    signal_.wait(lock, [this]() {
+      return !lastRevision_.has_value() ||
+          precomputingRevisionNumber_ != lastRevision_->getNumber();
+    });
+
+    if (!lastRevision_.has_value()) {
+      return {};
+    }
+  }
+
   number_++;
 
-  auto telemetry = lastRevision_->getTelemetry();
-  telemetry.willDiff();
+  auto mutations = ShadowViewMutationList{};
+  auto numberOfMutationsBeforeCompaction = int{};
+  auto telemetry = MountingTelemetry{};
 
-  auto mutations = calculateShadowViewMutations(
-      differentiatorMode,
-      baseRevision_.getRootShadowNode(),
-      lastRevision_->getRootShadowNode());
+  if (precomputedMutations_.has_value() &&
+      precomputedMutations_->revisionNumber == lastRevision_->getNumber() &&
+      precomputedMutations_->differentiatorMode == differentiatorMode) {
+    precomputationStatistics_.used++;
+    mutations = std::move(precomputedMutations_->mutations);
+    numberOfMutationsBeforeCompaction =
+        precomputedMutations_->numberOfMutationsBeforeCompaction;
+    telemetry = precomputedMutations_->telemetry;
+    precomputedMutations_.reset();
+  } else {
+    if (precomputedMutations_.has_value()) {
+      precomputationStatistics_.wasted++;
+      precomputedMutations_.reset();
+    }
 
-  telemetry.didDiff();
+    if (backgroundExecutor_) {
+      precomputationStatistics_.missed++;
+    }
+
+    telemetry = lastRevision_->getTelemetry();
+    telemetry.willDiff();
+
+    mutations = calculateShadowViewMutations(
+        differentiatorMode,
+        baseRevision_.getRootShadowNode(),
+        lastRevision_->getRootShadowNode());
+
+    numberOfMutationsBeforeCompaction = (int)mutations.size();
+    compactShadowViewMutations(mutations);
+
+    telemetry.didDiff();
+  }
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   stubViewTree_.mutate(mutations);
@@ -116,8 +265,11 @@ better::optional<MountingTransaction> MountingCoordinator::pullTransaction(
   baseRevision_ = std::move(*lastRevision_);
   lastRevision_.reset();
 
-  return MountingTransaction{
-      surfaceId_, number_, std::move(mutations), telemetry};
+  return MountingTransaction{surfaceId_,
+                             number_,
+                             std::move(mutations),
+                             telemetry,
+                             numberOfMutationsBeforeCompaction};
 }
 
 } // namespace react
@@ -9,10 +9,14 @@
 
 #include <better/optional.h>
 #include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 #include <react/mounting/Differentiator.h>
 #include <react/mounting/MountingTransaction.h>
 #include <react/mounting/ShadowTreeRevision.h>
+#include <react/utils/BackgroundExecutor.h>
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
 #include <react/mounting/stubs.h>
@@ -27,16 +31,43 @@ namespace react {
  * recent committed one. Then when a new mounting transaction is requested the
  * object generates mutation instructions and returns it as a
  * `MountingTransaction`.
+ * If a background executor is provided, the coordinator computes the mutations
+ * for the most recent revision on it as soon as the revision is pushed, so
+ * `pullTransaction` usually only hands over a ready transaction.
  */
-class MountingCoordinator final {
+class MountingCoordinator final
+    : public std::enable_shared_from_this<MountingCoordinator> {
  public:
   using Shared = std::shared_ptr<MountingCoordinator const>;
 
+  /*
+   * Counters which show how useful precomputing of mutations is.
+   */
+  struct PrecomputationStatistics {
+    /*
+     * Transactions which were pulled with precomputed mutations.
+     */
+    int used{0};
+
+    /*
+     * Precomputed mutations which were discarded because a newer revision
+     * was pushed (or a different `DifferentiatorMode` was requested).
+     */
+    int wasted{0};
+
+    /*
+     * Transactions which had to compute mutations on the pulling thread.
+     */
+    int missed{0};
+  };
+
   /*
    * The constructor is ment to be used only inside `ShadowTree`, and it's
    * `public` only to enable using with `std::make_shared<>`.
    */
-  MountingCoordinator(ShadowTreeRevision baseRevision);
+  MountingCoordinator(
+      ShadowTreeRevision baseRevision,
+      BackgroundExecutor backgroundExecutor = nullptr);
 
   /*
    * Returns the id of the surface that the coordinator belongs to.
@@ -66,6 +97,12 @@ class MountingCoordinator final {
    */
   bool waitForTransaction(std::chrono::duration<double> timeout) const;
 
+  /*
+   * Returns the counters of precomputed mutations. All counters are zero if
+   * the coordinator has no background executor.
+   */
+  PrecomputationStatistics getPrecomputationStatistics() const;
+
  private:
   friend class ShadowTree;
 
@@ -84,7 +121,34 @@ class MountingCoordinator final {
   void revoke() const;
 
  private:
+  /*
+   * Mutations between the base revision and the last one, computed with the
+   * given mode. The base revision changes only when the last revision is
+   * pulled, so the number of the last revision identifies both.
+   */
+  struct PrecomputedMutations {
+    ShadowTreeRevision::Number revisionNumber;
+    DifferentiatorMode differentiatorMode;
+    ShadowViewMutationList mutations;
+    int numberOfMutationsBeforeCompaction;
+    MountingTelemetry telemetry;
+  };
+
+  /*
+   * Schedules precomputing of mutations on the background executor. Must be
+   * called without `mutex_` locked (the executor might run the task
+   * synchronously).
+   */
+  void schedulePrecomputation() const;
+
+  /*
+   * Computes mutations for the last revision (whatever it is when the method
+   * is called) and stores them if the revision is still the last one.
+   */
+  void precompute() const;
+
   SurfaceId const surfaceId_;
+  BackgroundExecutor const backgroundExecutor_;
 
   mutable std::mutex mutex_;
   mutable ShadowTreeRevision baseRevision_;
@@ -92,6 +156,18 @@ class MountingCoordinator final {
   mutable MountingTransaction::Number number_{0};
   mutable std::condition_variable signal_;
 
+  /*
+   * Precomputing state, protected by `mutex_`. The mode of the last pulled
+   * transaction is used for precomputing the next one.
+   */
+  mutable DifferentiatorMode differentiatorMode_{DifferentiatorMode::Classic};
+  mutable bool isPrecomputationScheduled_{false};
+  mutable better::optional<ShadowTreeRevision::Number>
+      precomputingRevisionNumber_{};
+  mutable int numberOfRunningPrecomputations_{0};
+  mutable better::optional<PrecomputedMutations> precomputedMutations_{};
+  mutable PrecomputationStatistics precomputationStatistics_{};
+
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   mutable StubViewTree stubViewTree_; // Protected by `mutex_`.
 #endif
@@ -16,11 +16,13 @@ MountingTransaction::MountingTransaction(
     SurfaceId surfaceId,
     Number number,
     ShadowViewMutationList &&mutations,
-    MountingTelemetry telemetry)
+    MountingTelemetry telemetry,
+    int numberOfMutationsBeforeCompaction)
     : surfaceId_(surfaceId),
       number_(number),
       mutations_(std::move(mutations)),
-      telemetry_(std::move(telemetry)) {}
+      telemetry_(std::move(telemetry)),
+      numberOfMutationsBeforeCompaction_(numberOfMutationsBeforeCompaction) {}
 
 ShadowViewMutationList const &MountingTransaction::getMutations() const & {
   return mutations_;
@@ -42,5 +44,9 @@ Number MountingTransaction::getNumber() const {
   return number_;
 }
 
+int MountingTransaction::getNumberOfMutationsBeforeCompaction() const {
+  return numberOfMutationsBeforeCompaction_;
+}
+
 } // namespace react
 } // namespace facebook
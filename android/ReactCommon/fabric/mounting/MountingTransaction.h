@@ -31,12 +31,15 @@ class MountingTransaction final {
   /*
    * Copying a list of `ShadowViewMutation` is expensive, so the constructor
    * accepts it as rvalue reference to discourage copying.
+   * `numberOfMutationsBeforeCompaction` is the size of the list before
+   * `compactShadowViewMutations` was applied to it.
    */
   MountingTransaction(
       SurfaceId surfaceId,
       Number number,
       ShadowViewMutationList &&mutations,
-      MountingTelemetry telemetry);
+      MountingTelemetry telemetry,
+      int numberOfMutationsBeforeCompaction);
 
   /*
    * Copy semantic.
@@ -76,11 +79,18 @@ class MountingTransaction final {
    */
   Number getNumber() const;
 
+  /*
+   * Returns the number of mutations the transaction had before redundant
+   * mutations were removed from it (see `compactShadowViewMutations`).
+   */
+  int getNumberOfMutationsBeforeCompaction() const;
+
  private:
   SurfaceId surfaceId_;
   Number number_;
   ShadowViewMutationList mutations_;
   MountingTelemetry telemetry_;
+  int numberOfMutationsBeforeCompaction_;
 };
 
 } // namespace react
@@ -8,5 +8,20 @@
 #include "MountingTransactionMetadata.h"
 
 namespace facebook {
-namespace react {} // namespace react
+namespace react {
+
+MountingTransactionMetadata extractMountingTransactionMetadata(
+    MountingTransaction const &transaction) {
+  auto metadata = MountingTransactionMetadata{};
+  metadata.surfaceId = transaction.getSurfaceId();
+  metadata.number = transaction.getNumber();
+  metadata.telemetry = transaction.getTelemetry();
+  metadata.numberOfMutationsBeforeCompaction =
+      transaction.getNumberOfMutationsBeforeCompaction();
+  metadata.numberOfMutations =
+      static_cast<int>(transaction.getMutations().size());
+  return metadata;
+}
+
+} // namespace react
 } // namespace facebook
@@ -25,7 +25,21 @@ class MountingTransactionMetadata final {
   SurfaceId surfaceId;
   MountingTransaction::Number number;
   MountingTelemetry telemetry;
+
+  /*
+   * The number of mutations produced by diffing and the number of mutations
+   * left after redundant ones were removed (see `compactShadowViewMutations`).
+   */
+  int numberOfMutationsBeforeCompaction{0};
+  int numberOfMutations{0};
 };
 
+/*
+ * Collects all metadata of the given transaction, including the mutation
+ * counts. Use this instead of filling the fields one by one to not miss any.
+ */
+MountingTransactionMetadata extractMountingTransactionMetadata(
+    MountingTransaction const &transaction);
+
 } // namespace react
 } // namespace facebook
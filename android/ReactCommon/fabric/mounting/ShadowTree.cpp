@@ -86,7 +86,8 @@ ShadowTree::ShadowTree(
     LayoutConstraints const &layoutConstraints,
     LayoutContext const &layoutContext,
     RootComponentDescriptor const &rootComponentDescriptor,
-    ShadowTreeDelegate const &delegate)
+    ShadowTreeDelegate const &delegate,
+    BackgroundExecutor backgroundExecutor)
     : surfaceId_(surfaceId), delegate_(delegate) {
   const auto noopEventEmitter = std::make_shared<const ViewEventEmitter>(
       nullptr, -1, std::shared_ptr<const EventDispatcher>());
@@ -105,7 +106,8 @@ ShadowTree::ShadowTree(
           family));
 
   mountingCoordinator_ = std::make_shared<MountingCoordinator const>(
-      ShadowTreeRevision{rootShadowNode_, 0, {}});
+      ShadowTreeRevision{rootShadowNode_, 0, {}},
+      std::move(backgroundExecutor));
 }
 
 ShadowTree::~ShadowTree() {
@@ -120,6 +122,50 @@ MountingCoordinator::Shared ShadowTree::getMountingCoordinator() const {
   return mountingCoordinator_;
 }
 
+HitTestIndex::Shared ShadowTree::getHitTestIndex() const {
+  RootShadowNode::Shared rootShadowNode;
+
+  {
+    std::shared_lock<better::shared_mutex> lock(commitMutex_);
+    rootShadowNode = rootShadowNode_;
+  }
+
+  std::lock_guard<std::mutex> lock(hitTestIndexMutex_);
+
+  if (hitTestIndex_ &&
+      &hitTestIndex_->getRootShadowNode() == rootShadowNode.get()) {
+    return hitTestIndex_;
+  }
+
+  if (hitTestRequestedRootShadowNode_.lock() != rootShadowNode) {
+    hitTestRequestedRootShadowNode_ = rootShadowNode;
+    return nullptr;
+  }
+
+  SystraceSection s("ShadowTree::getHitTestIndex");
+  hitTestIndex_ = std::make_shared<HitTestIndex const>(rootShadowNode);
+  return hitTestIndex_;
+}
+
+LayoutMetricsCache::Shared ShadowTree::getLayoutMetricsCache() const {
+  RootShadowNode::Shared rootShadowNode;
+
+  {
+    std::shared_lock<better::shared_mutex> lock(commitMutex_);
+    rootShadowNode = rootShadowNode_;
+  }
+
+  std::lock_guard<std::mutex> lock(layoutMetricsCacheMutex_);
+
+  if (!layoutMetricsCache_ ||
+      &layoutMetricsCache_->getRootShadowNode() != rootShadowNode.get()) {
+    layoutMetricsCache_ =
+        std::make_shared<LayoutMetricsCache const>(rootShadowNode);
+  }
+
+  return layoutMetricsCache_;
+}
+
 void ShadowTree::commit(
     ShadowTreeCommitTransaction transaction,
     bool enableStateReconciliation) const {
@@ -206,6 +252,18 @@ bool ShadowTree::tryCommit(
     revisionNumber = revisionNumber_;
   }
 
+  {
+    // The index describes one of the previous revisions.
+    std::lock_guard<std::mutex> lock(hitTestIndexMutex_);
+    hitTestIndex_ = nullptr;
+  }
+
+  {
+    // Same for the cache.
+    std::lock_guard<std::mutex> lock(layoutMetricsCacheMutex_);
+    layoutMetricsCache_ = nullptr;
+  }
+
   emitLayoutEvents(affectedLayoutableNodes);
 
   telemetry.didCommit();
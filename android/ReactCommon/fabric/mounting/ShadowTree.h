@@ -9,15 +9,19 @@
 
 #include <better/mutex.h>
 #include <memory>
+#include <mutex>
 
 #include <react/components/root/RootComponentDescriptor.h>
 #include <react/components/root/RootShadowNode.h>
+#include <react/core/HitTestIndex.h>
 #include <react/core/LayoutConstraints.h>
+#include <react/core/LayoutMetricsCache.h>
 #include <react/core/ReactPrimitives.h>
 #include <react/core/ShadowNode.h>
 #include <react/mounting/MountingCoordinator.h>
 #include <react/mounting/ShadowTreeDelegate.h>
 #include <react/mounting/ShadowTreeRevision.h>
+#include <react/utils/BackgroundExecutor.h>
 
 namespace facebook {
 namespace react {
@@ -32,13 +36,16 @@ class ShadowTree final {
  public:
   /*
    * Creates a new shadow tree instance.
+   * If `backgroundExecutor` is provided, mutations for committed revisions
+   * are precomputed on it (see `MountingCoordinator`).
    */
   ShadowTree(
       SurfaceId surfaceId,
       LayoutConstraints const &layoutConstraints,
       LayoutContext const &layoutContext,
       RootComponentDescriptor const &rootComponentDescriptor,
-      ShadowTreeDelegate const &delegate);
+      ShadowTreeDelegate const &delegate,
+      BackgroundExecutor backgroundExecutor = nullptr);
 
   ~ShadowTree();
 
@@ -71,6 +78,22 @@ class ShadowTree final {
 
   MountingCoordinator::Shared getMountingCoordinator() const;
 
+  /*
+   * Returns a spatial index of the current revision of the tree for hit
+   * testing or `nullptr`. The index is built lazily on the second request made
+   * against the same revision (a single hit test is cheaper without it).
+   * Can be called from any thread.
+   */
+  HitTestIndex::Shared getHitTestIndex() const;
+
+  /*
+   * Returns memoized layout metrics of nodes of the current revision of the
+   * tree relative to its root node. A new cache is created after every
+   * commit; metrics are computed lazily.
+   * Can be called from any thread.
+   */
+  LayoutMetricsCache::Shared getLayoutMetricsCache() const;
+
  private:
   RootShadowNode::Unshared cloneRootShadowNode(
       RootShadowNode::Shared const &oldRootShadowNode,
@@ -88,6 +111,14 @@ class ShadowTree final {
   mutable ShadowTreeRevision::Number revisionNumber_{
       0}; // Protected by `commitMutex_`.
   MountingCoordinator::Shared mountingCoordinator_;
+  mutable std::mutex hitTestIndexMutex_;
+  mutable std::weak_ptr<RootShadowNode const>
+      hitTestRequestedRootShadowNode_; // Protected by `hitTestIndexMutex_`.
+  mutable HitTestIndex::Shared
+      hitTestIndex_; // Protected by `hitTestIndexMutex_`.
+  mutable std::mutex layoutMetricsCacheMutex_;
+  mutable LayoutMetricsCache::Shared
+      layoutMetricsCache_; // Protected by `layoutMetricsCacheMutex_`.
 };
 
 } // namespace react
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowViewMutationCompaction.h"
+
+#include <better/map.h>
+
+namespace facebook {
+namespace react {
+
+static Tag getChildTag(ShadowViewMutation const &mutation) {
+  return mutation.type == ShadowViewMutation::Delete ||
+          mutation.type == ShadowViewMutation::Remove
+      ? mutation.oldChildShadowView.tag
+      : mutation.newChildShadowView.tag;
+}
+
+static bool hasParent(ShadowViewMutation const &mutation) {
+  return mutation.type == ShadowViewMutation::Insert ||
+      mutation.type == ShadowViewMutation::Remove ||
+      mutation.type == ShadowViewMutation::Update;
+}
+
+/*
+ * Finds an `Insert` that puts the view removed by the `Remove` at
+ * `removePosition` back into the same position among its siblings, such that
+ * both mutations can be dropped without changing indices of any mutations in
+ * between. Returns `-1` if there is no such `Insert`.
+ * `isUpdated` is set if the view is updated between the two mutations.
+ */
+static int findRedundantInsert(
+    ShadowViewMutationList const &mutations,
+    std::vector<bool> const &dropped,
+    std::vector<int> const &parentPositions,
+    std::vector<int> const &childPositions,
+    int removePosition,
+    bool &isUpdated) {
+  auto const &remove = mutations[removePosition];
+  auto childTag = remove.oldChildShadowView.tag;
+
+  // The number of siblings which are before the removed view (as if it was
+  // never removed).
+  auto position = remove.index;
+  auto insertPosition = -1;
+
+  for (auto mutationPosition : parentPositions) {
+    if (mutationPosition <= removePosition || dropped[mutationPosition]) {
+      continue;
+    }
+
+    auto const &mutation = mutations[mutationPosition];
+    if (getChildTag(mutation) == childTag) {
+      if (mutation.type == ShadowViewMutation::Insert &&
+          mutation.index == position) {
+        insertPosition = mutationPosition;
+      }
+      break;
+    }
+
+    // Sibling mutations are fine as long as they do not touch siblings after
+    // the view; those would need different indices if the view stayed.
+    if (mutation.type == ShadowViewMutation::Remove &&
+        mutation.index < position) {
+      position--;
+    } else if (
+        mutation.type == ShadowViewMutation::Insert &&
+        mutation.index <= position) {
+      position++;
+    } else {
+      return -1;
+    }
+  }
+
+  if (insertPosition == -1) {
+    return -1;
+  }
+
+  // The view itself must not be inserted or removed anywhere else in between.
+  isUpdated = false;
+  for (auto mutationPosition : childPositions) {
+    if (mutationPosition <= removePosition ||
+        mutationPosition >= insertPosition || dropped[mutationPosition]) {
+      continue;
+    }
+
+    if (mutations[mutationPosition].type != ShadowViewMutation::Update) {
+      return -1;
+    }
+    isUpdated = true;
+  }
+
+  return insertPosition;
+}
+
+static void dropRedundantMoves(
+    ShadowViewMutationList &mutations,
+    std::vector<bool> &dropped) {
+  auto parentToPositions = better::map<Tag, std::vector<int>>{};
+  auto childToPositions = better::map<Tag, std::vector<int>>{};
+
+  for (int i = 0; i < mutations.size(); i++) {
+    auto const &mutation = mutations[i];
+    if (mutation.type == ShadowViewMutation::Insert ||
+        mutation.type == ShadowViewMutation::Remove) {
+      parentToPositions[mutation.parentShadowView.tag].push_back(i);
+    }
+    childToPositions[getChildTag(mutation)].push_back(i);
+  }
+
+  for (int i = 0; i < mutations.size(); i++) {
+    if (mutations[i].type != ShadowViewMutation::Remove || dropped[i]) {
+      continue;
+    }
+
+    auto &remove = mutations[i];
+    auto isUpdated = false;
+    auto insertPosition = findRedundantInsert(
+        mutations,
+        dropped,
+        parentToPositions[remove.parentShadowView.tag],
+        childToPositions[remove.oldChildShadowView.tag],
+        i,
+        isUpdated);
+    if (insertPosition == -1) {
+      continue;
+    }
+
+    auto &insert = mutations[insertPosition];
+    dropped[i] = true;
+
+    if (!isUpdated &&
+        insert.newChildShadowView == remove.oldChildShadowView) {
+      dropped[insertPosition] = true;
+    } else {
+      // `Insert` also delivers the (possibly changed) version of the view.
+      insert = ShadowViewMutation::UpdateMutation(
+          insert.parentShadowView,
+          remove.oldChildShadowView,
+          insert.newChildShadowView,
+          insert.index);
+    }
+  }
+}
+
+static void fuseUpdates(
+    ShadowViewMutationList &mutations,
+    std::vector<bool> &dropped) {
+  auto tagToLastUpdatePosition = better::map<Tag, int>{};
+
+  for (int i = 0; i < mutations.size(); i++) {
+    if (dropped[i]) {
+      continue;
+    }
+
+    auto &mutation = mutations[i];
+    auto tag = getChildTag(mutation);
+
+    if (mutation.type != ShadowViewMutation::Update) {
+      if (mutation.type == ShadowViewMutation::Create ||
+          mutation.type == ShadowViewMutation::Delete) {
+        tagToLastUpdatePosition.erase(tag);
+      }
+      continue;
+    }
+
+    auto iterator = tagToLastUpdatePosition.find(tag);
+    if (iterator != tagToLastUpdatePosition.end()) {
+      auto &previousUpdate = mutations[iterator->second];
+      mutation.oldChildShadowView = previousUpdate.oldChildShadowView;
+      dropped[iterator->second] = true;
+    }
+
+    tagToLastUpdatePosition[tag] = i;
+  }
+}
+
+static void dropUnmountedViews(
+    ShadowViewMutationList &mutations,
+    std::vector<bool> &dropped) {
+  struct Lifetime {
+    int createPosition;
+    std::vector<int> updatePositions;
+    bool isMounted;
+  };
+
+  auto tagToLifetime = better::map<Tag, Lifetime>{};
+
+  for (int i = 0; i < mutations.size(); i++) {
+    if (dropped[i]) {
+      continue;
+    }
+
+    auto const &mutation = mutations[i];
+    auto tag = getChildTag(mutation);
+
+    if (hasParent(mutation)) {
+      auto iterator = tagToLifetime.find(mutation.parentShadowView.tag);
+      if (iterator != tagToLifetime.end()) {
+        iterator->second.isMounted = true;
+      }
+    }
+
+    switch (mutation.type) {
+      case ShadowViewMutation::Create:
+        tagToLifetime[tag] = Lifetime{i, {}, false};
+        break;
+
+      case ShadowViewMutation::Delete: {
+        auto iterator = tagToLifetime.find(tag);
+        if (iterator == tagToLifetime.end()) {
+          break;
+        }
+
+        auto const &lifetime = iterator->second;
+        if (!lifetime.isMounted) {
+          dropped[lifetime.createPosition] = true;
+          for (auto position : lifetime.updatePositions) {
+            dropped[position] = true;
+          }
+          dropped[i] = true;
+        }
+
+        tagToLifetime.erase(iterator);
+        break;
+      }
+
+      case ShadowViewMutation::Update: {
+        auto iterator = tagToLifetime.find(tag);
+        if (iterator != tagToLifetime.end()) {
+          iterator->second.updatePositions.push_back(i);
+        }
+        break;
+      }
+
+      case ShadowViewMutation::Insert:
+      case ShadowViewMutation::Remove: {
+        auto iterator = tagToLifetime.find(tag);
+        if (iterator != tagToLifetime.end()) {
+          iterator->second.isMounted = true;
+        }
+        break;
+      }
+    }
+  }
+}
+
+void compactShadowViewMutations(ShadowViewMutationList &mutations) {
+  auto dropped = std::vector<bool>(mutations.size(), false);
+
+  dropRedundantMoves(mutations, dropped);
+  fuseUpdates(mutations, dropped);
+  dropUnmountedViews(mutations, dropped);
+
+  auto size = 0;
+  for (int i = 0; i < mutations.size(); i++) {
+    if (dropped[i]) {
+      continue;
+    }
+
+    if (size != i) {
+      mutations[size] = std::move(mutations[i]);
+    }
+    size++;
+  }
+
+  mutations.erase(mutations.begin() + size, mutations.end());
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/mounting/ShadowViewMutation.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Removes or fuses redundant mutations in the given list (in place):
+ *  - a `Remove` and an `Insert` which put a view back into the same position
+ *    among its siblings (replaced with an `Update` if the view has changed);
+ *  - several `Update`s of the same view (fused into the last one);
+ *  - a `Create` and a `Delete` of a view which was never inserted in between
+ *    (together with `Update`s of the view).
+ * Applying the compacted list to a view tree produces the same tree as
+ * applying the original one.
+ */
+void compactShadowViewMutations(ShadowViewMutationList &mutations);
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/components/root/RootComponentDescriptor.h>
+#include <react/components/view/ViewComponentDescriptor.h>
+#include <react/mounting/ShadowTree.h>
+#include <react/mounting/ShadowTreeDelegate.h>
+#include <react/mounting/stubs.h>
+
+namespace facebook {
+namespace react {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  void shadowTreeDidFinishTransaction(
+      ShadowTree const &shadowTree,
+      MountingCoordinator::Shared const &mountingCoordinator) const override {}
+};
+
+class MountingCoordinatorTest : public ::testing::Test {
+ protected:
+  MountingCoordinatorTest()
+      : rootComponentDescriptor_(ComponentDescriptorParameters{
+            EventDispatcher::Shared{},
+            std::make_shared<ContextContainer>(),
+            nullptr}),
+        viewComponentDescriptor_(ComponentDescriptorParameters{
+            EventDispatcher::Shared{},
+            std::make_shared<ContextContainer>(),
+            nullptr}) {}
+
+  ~MountingCoordinatorTest() {
+    joinThreads();
+  }
+
+  std::unique_ptr<ShadowTree> createShadowTree() {
+    return createShadowTree([this](std::function<void()> &&callback) {
+      scheduledCallbacks_.push_back(std::move(callback));
+    });
+  }
+
+  std::unique_ptr<ShadowTree> createShadowTree(
+      BackgroundExecutor backgroundExecutor) {
+    return std::make_unique<ShadowTree>(
+        SurfaceId{1},
+        LayoutConstraints{},
+        LayoutContext{},
+        rootComponentDescriptor_,
+        delegate_,
+        backgroundExecutor);
+  }
+
+  void runScheduledCallbacks() {
+    auto callbacks = std::move(scheduledCallbacks_);
+    scheduledCallbacks_.clear();
+    for (auto &callback : callbacks) {
+      callback();
+    }
+  }
+
+  /*
+   * Runs every callback on its own thread, so precomputations run
+   * concurrently with each other and with the calling thread.
+   */
+  BackgroundExecutor createThreadExecutor() {
+    return [this](std::function<void()> &&callback) {
+      std::lock_guard<std::mutex> lock(threadsMutex_);
+      threads_.emplace_back([this, callback = std::move(callback)]() {
+        {
+          std::lock_guard<std::mutex> lock(threadsMutex_);
+          numberOfStartedCallbacks_++;
+        }
+        threadsSignal_.notify_all();
+        callback();
+      });
+    };
+  }
+
+  void waitForStartedCallbacks(int numberOfStartedCallbacks) {
+    std::unique_lock<std::mutex> lock(threadsMutex_);
+    threadsSignal_.wait(lock, [&]() {
+      return numberOfStartedCallbacks_ >= numberOfStartedCallbacks;
+    });
+  }
+
+  void joinThreads() {
+    while (true) {
+      auto threads = std::vector<std::thread>{};
+      {
+        std::lock_guard<std::mutex> lock(threadsMutex_);
+        threads = std::move(threads_);
+        threads_.clear();
+      }
+
+      if (threads.empty()) {
+        return;
+      }
+
+      for (auto &thread : threads) {
+        thread.join();
+      }
+    }
+  }
+
+  /*
+   * Commits a tree of `width` views with `width` children each and returns
+   * the new root. Diffing a few thousand views takes long enough to pull or
+   * revoke while a precomputation is running.
+   */
+  RootShadowNode::Shared commitViewTree(
+      ShadowTree const &shadowTree,
+      int width) {
+    auto children = SharedShadowNodeList{};
+    for (int i = 0; i < width; i++) {
+      auto grandchildren = SharedShadowNodeList{};
+      for (int j = 0; j < width; j++) {
+        grandchildren.push_back(createView({}));
+      }
+      children.push_back(createView(std::move(grandchildren)));
+    }
+
+    auto newRootShadowNode = RootShadowNode::Shared{};
+    shadowTree.commit(
+        [&](RootShadowNode::Shared const &oldRootShadowNode) {
+          auto rootShadowNode = std::make_shared<RootShadowNode>(
+              *oldRootShadowNode,
+              ShadowNodeFragment{
+                  /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+                  /* .children = */
+                  std::make_shared<SharedShadowNodeList>(
+                      SharedShadowNodeList{createView(children)}),
+              });
+          newRootShadowNode = rootShadowNode;
+          return rootShadowNode;
+        });
+    return newRootShadowNode;
+  }
+
+  /*
+   * The view tree of a surface that mounted only the root view; that's what
+   * every shadow tree starts with.
+   */
+  static StubViewTree createRootViewTree(ShadowNode const &rootShadowNode) {
+    return StubViewTree(ShadowView(*rootShadowNode.clone(ShadowNodeFragment{
+        /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+        /* .children = */ ShadowNode::emptySharedShadowNodeSharedList(),
+    })));
+  }
+
+  ShadowNode::Shared createView(SharedShadowNodeList children) {
+    auto family = viewComponentDescriptor_.createFamily(
+        ShadowNodeFamilyFragment{
+            /* .tag = */ nextTag_++,
+            /* .surfaceId = */ SurfaceId{1},
+            /* .eventEmitter = */ nullptr,
+        },
+        nullptr);
+    return viewComponentDescriptor_.createShadowNode(
+        ShadowNodeFragment{
+            /* .props = */ ViewShadowNode::defaultSharedProps(),
+            /* .children = */
+            std::make_shared<SharedShadowNodeList>(std::move(children)),
+        },
+        family);
+  }
+
+  RootComponentDescriptor rootComponentDescriptor_;
+  ViewComponentDescriptor viewComponentDescriptor_;
+  DummyShadowTreeDelegate delegate_;
+  std::vector<std::function<void()>> scheduledCallbacks_;
+  Tag nextTag_{2};
+
+  std::mutex threadsMutex_;
+  std::condition_variable threadsSignal_;
+  std::vector<std::thread> threads_;
+  int numberOfStartedCallbacks_{0};
+};
+
+TEST_F(MountingCoordinatorTest, handsOverPrecomputedTransaction) {
+  auto shadowTree = createShadowTree();
+  auto mountingCoordinator = shadowTree->getMountingCoordinator();
+
+  shadowTree->commitEmptyTree();
+  EXPECT_EQ(scheduledCallbacks_.size(), 1);
+  runScheduledCallbacks();
+
+  auto transaction =
+      mountingCoordinator->pullTransaction(DifferentiatorMode::Classic);
+  EXPECT_TRUE(transaction.has_value());
+
+  auto statistics = mountingCoordinator->getPrecomputationStatistics();
+  EXPECT_EQ(statistics.used, 1);
+  EXPECT_EQ(statistics.wasted, 0);
+  EXPECT_EQ(statistics.missed, 0);
+}
+
+TEST_F(MountingCoordinatorTest, discardsStalePrecomputations) {
+  auto shadowTree = createShadowTree();
+  auto mountingCoordinator = shadowTree->getMountingCoordinator();
+
+  shadowTree->commitEmptyTree();
+  runScheduledCallbacks();
+
+  // The precomputed mutations are stale now; a precomputation for the new
+  // revision is scheduled but the transaction is pulled before it runs.
+  shadowTree->commitEmptyTree();
+  EXPECT_EQ(scheduledCallbacks_.size(), 1);
+
+  auto transaction =
+      mountingCoordinator->pullTransaction(DifferentiatorMode::Classic);
+  EXPECT_TRUE(transaction.has_value());
+  runScheduledCallbacks();
+
+  auto statistics = mountingCoordinator->getPrecomputationStatistics();
+  EXPECT_EQ(statistics.used, 0);
+  EXPECT_EQ(statistics.wasted, 1);
+  EXPECT_EQ(statistics.missed, 1);
+
+  EXPECT_FALSE(mountingCoordinator->pullTransaction(DifferentiatorMode::Classic)
+                   .has_value());
+}
+
+TEST_F(MountingCoordinatorTest, coalescesScheduledPrecomputations) {
+  auto shadowTree = createShadowTree();
+  auto mountingCoordinator = shadowTree->getMountingCoordinator();
+
+  shadowTree->commitEmptyTree();
+  shadowTree->commitEmptyTree();
+  shadowTree->commitEmptyTree();
+  EXPECT_EQ(scheduledCallbacks_.size(), 1);
+  runScheduledCallbacks();
+
+  auto transaction =
+      mountingCoordinator->pullTransaction(DifferentiatorMode::Classic);
+  EXPECT_TRUE(transaction.has_value());
+  EXPECT_EQ(mountingCoordinator->getPrecomputationStatistics().used, 1);
+}
+
+TEST_F(MountingCoordinatorTest, pullsWhilePrecomputing) {
+  auto shadowTree = createShadowTree(createThreadExecutor());
+  auto mountingCoordinator = shadowTree->getMountingCoordinator();
+
+  auto rootShadowNode = commitViewTree(*shadowTree, 40);
+  waitForStartedCallbacks(1);
+
+  // Pulling waits for the running diff instead of starting another one.
+  auto transaction =
+      mountingCoordinator->pullTransaction(DifferentiatorMode::Classic);
+  ASSERT_TRUE(transaction.has_value());
+
+  auto viewTree = createRootViewTree(*rootShadowNode);
+  viewTree.mutate(transaction->getMutations());
+  EXPECT_EQ(viewTree, stubViewTreeFromShadowNode(*rootShadowNode));
+
+  joinThreads();
+  auto statistics = mountingCoordinator->getPrecomputationStatistics();
+  EXPECT_EQ(statistics.used + statistics.missed, 1);
+  EXPECT_FALSE(mountingCoordinator->pullTransaction(DifferentiatorMode::Classic)
+                   .has_value());
+}
+
+TEST_F(MountingCoordinatorTest, revokesWhilePrecomputing) {
+  auto shadowTree = createShadowTree(createThreadExecutor());
+  auto mountingCoordinator = shadowTree->getMountingCoordinator();
+
+  auto weakRootShadowNode =
+      std::weak_ptr<RootShadowNode const>{commitViewTree(*shadowTree, 40)};
+  waitForStartedCallbacks(1);
+
+  // Destroying the shadow tree revokes the revisions. That waits until the
+  // running diff releases its shadow nodes.
+  shadowTree.reset();
+  EXPECT_TRUE(weakRootShadowNode.expired());
+  EXPECT_FALSE(mountingCoordinator->pullTransaction(DifferentiatorMode::Classic)
+                   .has_value());
+}
+
+TEST_F(MountingCoordinatorTest, overlapsPrecomputations) {
+  auto shadowTree = createShadowTree(createThreadExecutor());
+  auto mountingCoordinator = shadowTree->getMountingCoordinator();
+
+  auto rootShadowNode = RootShadowNode::Shared{};
+  for (int i = 0; i < 8; i++) {
+    rootShadowNode = commitViewTree(*shadowTree, 20);
+  }
+  joinThreads();
+
+  // Whatever ran concurrently, the last precomputation diffed the last
+  // revision.
+  auto transaction =
+      mountingCoordinator->pullTransaction(DifferentiatorMode::Classic);
+  ASSERT_TRUE(transaction.has_value());
+
+  auto viewTree = createRootViewTree(*rootShadowNode);
+  viewTree.mutate(transaction->getMutations());
+  EXPECT_EQ(viewTree, stubViewTreeFromShadowNode(*rootShadowNode));
+
+  auto statistics = mountingCoordinator->getPrecomputationStatistics();
+  EXPECT_EQ(statistics.used, 1);
+  EXPECT_EQ(statistics.missed, 0);
+}
+
+TEST_F(MountingCoordinatorTest, pullsWhileCommitting) {
+  auto shadowTree = createShadowTree(createThreadExecutor());
+  auto mountingCoordinator = shadowTree->getMountingCoordinator();
+
+  auto rootShadowNode = commitViewTree(*shadowTree, 10);
+  auto viewTree = createRootViewTree(*rootShadowNode);
+
+  auto isCommitting = std::atomic<bool>{true};
+  auto committer = std::thread([&]() {
+    for (int i = 0; i < 20; i++) {
+      rootShadowNode = commitViewTree(*shadowTree, 10 + i % 5);
+    }
+    isCommitting = false;
+  });
+
+  // Every transaction continues where the previous one ended, no matter
+  // whether its mutations were precomputed.
+  auto numberOfTransactions = 0;
+  auto pullTransaction = [&]() {
+    auto transaction =
+        mountingCoordinator->pullTransaction(DifferentiatorMode::Classic);
+    if (transaction.has_value()) {
+      viewTree.mutate(transaction->getMutations());
+      numberOfTransactions++;
+    }
+  };
+
+  while (isCommitting) {
+    mountingCoordinator->waitForTransaction(std::chrono::milliseconds(10));
+    pullTransaction();
+  }
+  committer.join();
+  pullTransaction();
+
+  EXPECT_GT(numberOfTransactions, 0);
+  EXPECT_EQ(viewTree, stubViewTreeFromShadowNode(*rootShadowNode));
+
+  joinThreads();
+}
+
+} // namespace react
+} // namespace facebook
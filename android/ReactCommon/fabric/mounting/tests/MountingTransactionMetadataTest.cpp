@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/mounting/MountingTransactionMetadata.h>
+
+using namespace facebook::react;
+
+TEST(MountingTransactionMetadataTest, extractsMutationCounts) {
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::CreateMutation(ShadowView{}),
+      ShadowViewMutation::DeleteMutation(ShadowView{}),
+  };
+  auto transaction = MountingTransaction{
+      SurfaceId{7}, 3, std::move(mutations), MountingTelemetry{}, 5};
+
+  auto metadata = extractMountingTransactionMetadata(transaction);
+  EXPECT_EQ(metadata.surfaceId, 7);
+  EXPECT_EQ(metadata.number, 3);
+  EXPECT_EQ(metadata.numberOfMutationsBeforeCompaction, 5);
+  EXPECT_EQ(metadata.numberOfMutations, 2);
+}
@@ -11,6 +11,7 @@
 #include <react/components/root/RootComponentDescriptor.h>
 #include <react/components/view/ViewComponentDescriptor.h>
 #include <react/mounting/Differentiator.h>
+#include <react/mounting/ShadowViewMutationCompaction.h>
 #include <react/mounting/stubs.h>
 
 #include "Entropy.h"
@@ -75,6 +76,15 @@ static void testShadowNodeTreeLifeCycle(
     viewTree.mutate(calculateShadowViewMutations(
         differentiatorMode, *emptyRootNode, *currentRootNode));
 
+    // The same view hierarchy, but built with compacted mutations.
+    auto compactedViewTree = stubViewTreeFromShadowNode(*emptyRootNode);
+    {
+      auto mutations = calculateShadowViewMutations(
+          differentiatorMode, *emptyRootNode, *currentRootNode);
+      compactShadowViewMutations(mutations);
+      compactedViewTree.mutate(mutations);
+    }
+
     for (int j = 0; j < stages; j++) {
       auto nextRootNode = currentRootNode;
 
@@ -105,6 +115,11 @@ static void testShadowNodeTreeLifeCycle(
       // Mutating the view tree.
       viewTree.mutate(mutations);
 
+      // Mutating the other view tree with compacted mutations.
+      auto compactedMutations = mutations;
+      compactShadowViewMutations(compactedMutations);
+      compactedViewTree.mutate(compactedMutations);
+
       // Building a view tree to compare with.
       auto rebuiltViewTree = stubViewTreeFromShadowNode(*nextRootNode);
 
@@ -132,6 +147,22 @@ static void testShadowNodeTreeLifeCycle(
         FAIL();
       }
 
+      // Compacted mutations must produce the very same view tree.
+      if (rebuiltViewTree != compactedViewTree) {
+        LOG(ERROR) << "Entropy seed: " << entropy.getSeed() << "\n";
+
+        LOG(ERROR) << "Mutations:"
+                   << "\n"
+                   << getDebugDescription(mutations, {});
+        LOG(ERROR) << "Compacted mutations:"
+                   << "\n"
+                   << getDebugDescription(compactedMutations, {});
+
+        FAIL();
+      }
+
+      EXPECT_LE(compactedMutations.size(), mutations.size());
+
       currentRootNode = nextRootNode;
     }
   }
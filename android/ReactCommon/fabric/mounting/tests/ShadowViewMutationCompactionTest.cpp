@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/mounting/ShadowViewMutationCompaction.h>
+
+using namespace facebook::react;
+
+static ShadowView makeShadowView(Tag tag, Float width = 0) {
+  auto shadowView = ShadowView{};
+  shadowView.tag = tag;
+  shadowView.layoutMetrics.frame.size.width = width;
+  return shadowView;
+}
+
+TEST(ShadowViewMutationCompactionTest, removeAndInsertIntoSamePosition) {
+  auto parent = makeShadowView(1);
+  auto a = makeShadowView(2);
+  auto b = makeShadowView(3);
+  auto c = makeShadowView(4);
+  auto x = makeShadowView(5);
+
+  // [a, b, c] -> [a, x, c], as the classic differentiator does it.
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::RemoveMutation(parent, c, 2),
+      ShadowViewMutation::RemoveMutation(parent, b, 1),
+      ShadowViewMutation::CreateMutation(x),
+      ShadowViewMutation::InsertMutation(parent, x, 1),
+      ShadowViewMutation::InsertMutation(parent, c, 2),
+      ShadowViewMutation::DeleteMutation(b),
+  };
+
+  compactShadowViewMutations(mutations);
+
+  EXPECT_EQ(mutations.size(), 4);
+  EXPECT_EQ(mutations[0].type, ShadowViewMutation::Remove);
+  EXPECT_EQ(mutations[0].oldChildShadowView.tag, b.tag);
+  EXPECT_EQ(mutations[1].type, ShadowViewMutation::Create);
+  EXPECT_EQ(mutations[2].type, ShadowViewMutation::Insert);
+  EXPECT_EQ(mutations[2].newChildShadowView.tag, x.tag);
+  EXPECT_EQ(mutations[3].type, ShadowViewMutation::Delete);
+}
+
+TEST(ShadowViewMutationCompactionTest, removeAndInsertOfChangedView) {
+  auto parent = makeShadowView(1);
+  auto oldChild = makeShadowView(2, 10);
+  auto newChild = makeShadowView(2, 20);
+
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::RemoveMutation(parent, oldChild, 0),
+      ShadowViewMutation::InsertMutation(parent, newChild, 0),
+  };
+
+  compactShadowViewMutations(mutations);
+
+  EXPECT_EQ(mutations.size(), 1);
+  EXPECT_EQ(mutations[0].type, ShadowViewMutation::Update);
+  EXPECT_EQ(mutations[0].oldChildShadowView, oldChild);
+  EXPECT_EQ(mutations[0].newChildShadowView, newChild);
+}
+
+TEST(ShadowViewMutationCompactionTest, moves) {
+  auto parent = makeShadowView(1);
+  auto a = makeShadowView(2);
+  auto b = makeShadowView(3);
+
+  // [a, b] -> [b, a]; moving `a` alone is enough.
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::RemoveMutation(parent, b, 1),
+      ShadowViewMutation::RemoveMutation(parent, a, 0),
+      ShadowViewMutation::InsertMutation(parent, b, 0),
+      ShadowViewMutation::InsertMutation(parent, a, 1),
+  };
+
+  compactShadowViewMutations(mutations);
+
+  EXPECT_EQ(mutations.size(), 2);
+  EXPECT_EQ(mutations[0].type, ShadowViewMutation::Remove);
+  EXPECT_EQ(mutations[0].oldChildShadowView.tag, a.tag);
+  EXPECT_EQ(mutations[0].index, 0);
+  EXPECT_EQ(mutations[1].type, ShadowViewMutation::Insert);
+  EXPECT_EQ(mutations[1].newChildShadowView.tag, a.tag);
+  EXPECT_EQ(mutations[1].index, 1);
+}
+
+TEST(ShadowViewMutationCompactionTest, updates) {
+  auto parent = makeShadowView(1);
+  auto first = makeShadowView(2, 10);
+  auto second = makeShadowView(2, 20);
+  auto third = makeShadowView(2, 30);
+
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::UpdateMutation(parent, first, second, 0),
+      ShadowViewMutation::UpdateMutation(parent, second, third, 0),
+  };
+
+  compactShadowViewMutations(mutations);
+
+  EXPECT_EQ(mutations.size(), 1);
+  EXPECT_EQ(mutations[0].oldChildShadowView, first);
+  EXPECT_EQ(mutations[0].newChildShadowView, third);
+}
+
+TEST(ShadowViewMutationCompactionTest, createAndDeleteOfUnmountedView) {
+  auto parent = makeShadowView(1);
+  auto child = makeShadowView(2, 10);
+  auto updatedChild = makeShadowView(2, 20);
+  auto mountedChild = makeShadowView(3);
+
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::CreateMutation(child),
+      ShadowViewMutation::CreateMutation(mountedChild),
+      ShadowViewMutation::InsertMutation(parent, mountedChild, 0),
+      ShadowViewMutation::UpdateMutation(parent, child, updatedChild, 0),
+      ShadowViewMutation::RemoveMutation(parent, mountedChild, 0),
+      ShadowViewMutation::DeleteMutation(updatedChild),
+      ShadowViewMutation::DeleteMutation(mountedChild),
+  };
+
+  compactShadowViewMutations(mutations);
+
+  EXPECT_EQ(mutations.size(), 4);
+  for (auto const &mutation : mutations) {
+    auto tag = mutation.type == ShadowViewMutation::Delete ||
+            mutation.type == ShadowViewMutation::Remove
+        ? mutation.oldChildShadowView.tag
+        : mutation.newChildShadowView.tag;
+    EXPECT_EQ(tag, mountedChild.tag);
+  }
+}
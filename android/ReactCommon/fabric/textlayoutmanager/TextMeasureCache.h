@@ -10,7 +10,6 @@
 #include <react/attributedstring/AttributedString.h>
 #include <react/attributedstring/ParagraphAttributes.h>
 #include <react/core/LayoutConstraints.h>
-#include <react/utils/FloatComparison.h>
 #include <react/utils/SimpleThreadSafeCache.h>
 
 namespace facebook {
@@ -59,107 +58,6 @@ using TextMeasureCache = SimpleThreadSafeCache<
     TextMeasurement,
     kSimpleThreadSafeCacheSizeCap>;
 
-inline bool areTextAttributesEquivalentLayoutWise(
-    TextAttributes const &lhs,
-    TextAttributes const &rhs) {
-  // Here we check all attributes that affect layout metrics and don't check any
-  // attributes that affect only a decorative aspect of displayed text (like
-  // colors).
-  return std::tie(
-             lhs.fontFamily,
-             lhs.fontWeight,
-             lhs.fontStyle,
-             lhs.fontVariant,
-             lhs.allowFontScaling,
-             lhs.alignment) ==
-      std::tie(
-             rhs.fontFamily,
-             rhs.fontWeight,
-             rhs.fontStyle,
-             rhs.fontVariant,
-             rhs.allowFontScaling,
-             rhs.alignment) &&
-      floatEquality(lhs.fontSize, rhs.fontSize) &&
-      floatEquality(lhs.fontSizeMultiplier, rhs.fontSizeMultiplier) &&
-      floatEquality(lhs.letterSpacing, rhs.letterSpacing) &&
-      floatEquality(lhs.lineHeight, rhs.lineHeight);
-}
-
-inline size_t textAttributesHashLayoutWise(
-    TextAttributes const &textAttributes) {
-  // Taking into account the same props as
-  // `areTextAttributesEquivalentLayoutWise` mentions.
-  return folly::hash::hash_combine(
-      0,
-      textAttributes.fontFamily,
-      textAttributes.fontSize,
-      textAttributes.fontSizeMultiplier,
-      textAttributes.fontWeight,
-      textAttributes.fontStyle,
-      textAttributes.fontVariant,
-      textAttributes.allowFontScaling,
-      textAttributes.letterSpacing,
-      textAttributes.lineHeight,
-      textAttributes.alignment);
-}
-
-inline bool areAttributedStringFragmentsEquivalentLayoutWise(
-    AttributedString::Fragment const &lhs,
-    AttributedString::Fragment const &rhs) {
-  return lhs.string == rhs.string &&
-      areTextAttributesEquivalentLayoutWise(
-             lhs.textAttributes, rhs.textAttributes) &&
-      // LayoutMetrics of an attachment fragment affects the size of a measured
-      // attributed string.
-      (!lhs.isAttachment() ||
-       (lhs.parentShadowView.layoutMetrics ==
-        rhs.parentShadowView.layoutMetrics));
-}
-
-inline size_t textAttributesHashLayoutWise(
-    AttributedString::Fragment const &fragment) {
-  // Here we are not taking `isAttachment` and `layoutMetrics` into account
-  // because they are logically interdependent and this can break an invariant
-  // between hash and equivalence functions (and cause cache misses).
-  return folly::hash::hash_combine(
-      0,
-      fragment.string,
-      textAttributesHashLayoutWise(fragment.textAttributes));
-}
-
-inline bool areAttributedStringsEquivalentLayoutWise(
-    AttributedString const &lhs,
-    AttributedString const &rhs) {
-  auto &lhsFragment = lhs.getFragments();
-  auto &rhsFragment = rhs.getFragments();
-
-  if (lhsFragment.size() != rhsFragment.size()) {
-    return false;
-  }
-
-  auto size = lhsFragment.size();
-  for (auto i = size_t{0}; i < size; i++) {
-    if (!areAttributedStringFragmentsEquivalentLayoutWise(
-            lhsFragment.at(i), rhsFragment.at(i))) {
-      return false;
-    }
-  }
-
-  return true;
-}
-
-inline size_t textAttributedStringHashLayoutWise(
-    AttributedString const &attributedString) {
-  auto seed = size_t{0};
-
-  for (auto const &fragment : attributedString.getFragments()) {
-    seed =
-        folly::hash::hash_combine(seed, textAttributesHashLayoutWise(fragment));
-  }
-
-  return seed;
-}
-
 inline bool operator==(
     TextMeasureCacheKey const &lhs,
     TextMeasureCacheKey const &rhs) {
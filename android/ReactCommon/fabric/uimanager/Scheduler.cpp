@@ -24,6 +24,7 @@ Scheduler::Scheduler(
     SchedulerToolbox schedulerToolbox,
     SchedulerDelegate *delegate) {
   runtimeExecutor_ = schedulerToolbox.runtimeExecutor;
+  backgroundExecutor_ = schedulerToolbox.backgroundExecutor;
 
   reactNativeConfig_ =
       schedulerToolbox.contextContainer
@@ -43,8 +44,8 @@ Scheduler::Scheduler(
     });
   };
 
-  auto statePipe = [uiManager](StateUpdate const &stateUpdate) {
-    uiManager->updateState(stateUpdate);
+  auto statePipe = [uiManager](std::vector<StateUpdate> const &stateUpdates) {
+    uiManager->updateStates(stateUpdates);
   };
 
   eventDispatcher_ = std::make_shared<EventDispatcher>(
@@ -56,6 +57,13 @@ Scheduler::Scheduler(
 
   eventOwnerBox->owner = eventDispatcher_;
 
+  // Note: `insert` does not override a value the host might have already put
+  // into the container.
+  schedulerToolbox.contextContainer->insert(
+      kPropsDiffingContextContainerKey,
+      reactNativeConfig_ &&
+          reactNativeConfig_->getBool("react_fabric:enable_props_diffing"));
+
   componentDescriptorRegistry_ = schedulerToolbox.componentRegistryFactory(
       eventDispatcher_, schedulerToolbox.contextContainer);
 
@@ -139,7 +147,8 @@ void Scheduler::startSurface(
       layoutConstraints,
       layoutContext,
       *rootComponentDescriptor_,
-      *uiManager_);
+      *uiManager_,
+      backgroundExecutor_);
 
   auto uiManager = uiManager_;
 
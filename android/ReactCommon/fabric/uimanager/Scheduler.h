@@ -20,6 +20,7 @@
 #include <react/uimanager/SchedulerToolbox.h>
 #include <react/uimanager/UIManagerBinding.h>
 #include <react/uimanager/UIManagerDelegate.h>
+#include <react/utils/BackgroundExecutor.h>
 #include <react/utils/ContextContainer.h>
 #include <react/utils/RuntimeExecutor.h>
 
@@ -109,6 +110,7 @@ class Scheduler final : public UIManagerDelegate {
   SharedComponentDescriptorRegistry componentDescriptorRegistry_;
   std::unique_ptr<const RootComponentDescriptor> rootComponentDescriptor_;
   RuntimeExecutor runtimeExecutor_;
+  BackgroundExecutor backgroundExecutor_;
   std::shared_ptr<UIManager> uiManager_;
   std::shared_ptr<const ReactNativeConfig> reactNativeConfig_;
   EventDispatcher::Shared eventDispatcher_;
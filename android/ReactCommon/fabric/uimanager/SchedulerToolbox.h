@@ -9,6 +9,7 @@
 
 #include <react/core/EventBeat.h>
 #include <react/uimanager/ComponentDescriptorFactory.h>
+#include <react/utils/BackgroundExecutor.h>
 #include <react/utils/ContextContainer.h>
 #include <react/utils/RuntimeExecutor.h>
 
@@ -43,6 +44,13 @@ struct SchedulerToolbox final {
    */
   EventBeat::Factory asynchronousEventBeatFactory;
   EventBeat::Factory synchronousEventBeatFactory;
+
+  /*
+   * General purpose background queue for work which does not need to block
+   * the JavaScript or the main thread (e.g. precomputing mount transactions).
+   * Optional.
+   */
+  BackgroundExecutor backgroundExecutor;
 };
 
 } // namespace react
@@ -7,6 +7,10 @@
 
 #include "UIManager.h"
 
+#include <algorithm>
+
+#include <better/map.h>
+#include <better/small_vector.h>
 #include <react/core/ShadowNodeFragment.h>
 #include <react/debug/SystraceSection.h>
 #include <react/graphics/Geometry.h>
@@ -155,8 +159,20 @@ ShadowNode::Shared const *UIManager::getNewestCloneOfShadowNode(
 ShadowNode::Shared UIManager::findNodeAtPoint(
     ShadowNode::Shared const &node,
     Point point) const {
-  return LayoutableShadowNode::findNodeAtPoint(
-      *getNewestCloneOfShadowNode(node), point);
+  auto const &newestShadowNode = *getNewestCloneOfShadowNode(node);
+
+  auto hitTestIndex = HitTestIndex::Shared{};
+  shadowTreeRegistry_.visit(
+      node->getSurfaceId(), [&](ShadowTree const &shadowTree) {
+        hitTestIndex = shadowTree.getHitTestIndex();
+      });
+
+  // The tree might be committed after `newestShadowNode` was found.
+  if (hitTestIndex && hitTestIndex->contains(*newestShadowNode)) {
+    return hitTestIndex->findNodeAtPoint(*newestShadowNode, point);
+  }
+
+  return LayoutableShadowNode::findNodeAtPoint(newestShadowNode, point);
 }
 
 void UIManager::setNativeProps(
@@ -191,15 +207,14 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
   SystraceSection s("UIManager::getRelativeLayoutMetrics");
 
   if (!ancestorShadowNode) {
+    auto layoutMetrics = EmptyLayoutMetrics;
     shadowTreeRegistry_.visit(
         shadowNode.getSurfaceId(), [&](ShadowTree const &shadowTree) {
-          shadowTree.tryCommit(
-              [&](RootShadowNode::Shared const &oldRootShadowNode) {
-                ancestorShadowNode = oldRootShadowNode.get();
-                return nullptr;
-              },
-              true);
+          layoutMetrics =
+              shadowTree.getLayoutMetricsCache()->getRelativeLayoutMetrics(
+                  shadowNode, policy);
         });
+    return layoutMetrics;
   }
 
   auto layoutableShadowNode =
@@ -215,31 +230,87 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
       *layoutableAncestorShadowNode, policy);
 }
 
-void UIManager::updateState(StateUpdate const &stateUpdate) const {
-  auto &callback = stateUpdate.callback;
-  auto &family = stateUpdate.family;
-  auto &componentDescriptor = family->getComponentDescriptor();
+std::vector<LayoutMetrics> UIManager::getRelativeLayoutMetrics(
+    std::vector<ShadowNode::Shared> const &shadowNodes,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) const {
+  SystraceSection s("UIManager::getRelativeLayoutMetrics (batch)");
+
+  auto layoutMetrics = std::vector<LayoutMetrics>{};
+  layoutMetrics.reserve(shadowNodes.size());
+
+  // Nodes usually belong to a single surface, so the cache is requested once
+  // per run of nodes of the same surface.
+  auto surfaceId = SurfaceId{-1};
+  auto layoutMetricsCache = LayoutMetricsCache::Shared{};
+
+  for (auto const &shadowNode : shadowNodes) {
+    if (shadowNode->getSurfaceId() != surfaceId) {
+      surfaceId = shadowNode->getSurfaceId();
+      layoutMetricsCache = nullptr;
+      shadowTreeRegistry_.visit(surfaceId, [&](ShadowTree const &shadowTree) {
+        layoutMetricsCache = shadowTree.getLayoutMetricsCache();
+      });
+    }
 
-  shadowTreeRegistry_.visit(
-      family->getSurfaceId(), [&](ShadowTree const &shadowTree) {
-        shadowTree.tryCommit([&](RootShadowNode::Shared const
-                                     &oldRootShadowNode) {
-          return std::static_pointer_cast<
-              RootShadowNode>(oldRootShadowNode->cloneTree(
-              *family, [&](ShadowNode const &oldShadowNode) {
-                auto newData =
-                    callback(oldShadowNode.getState()->getDataPointer());
-                auto newState =
-                    componentDescriptor.createState(*family, newData);
-
-                return oldShadowNode.clone({
-                    /* .props = */ ShadowNodeFragment::propsPlaceholder(),
-                    /* .children = */ ShadowNodeFragment::childrenPlaceholder(),
-                    /* .state = */ newState,
-                });
-              }));
-        });
+    layoutMetrics.push_back(
+        layoutMetricsCache
+            ? layoutMetricsCache->getRelativeLayoutMetrics(*shadowNode, policy)
+            : EmptyLayoutMetrics);
+  }
+
+  return layoutMetrics;
+}
+
+void UIManager::updateStates(
+    std::vector<StateUpdate> const &stateUpdates) const {
+  SystraceSection s("UIManager::updateStates");
+
+  // Group updates by surface preserving their order.
+  auto surfaceIds = better::small_vector<SurfaceId, 4>{};
+  for (auto const &stateUpdate : stateUpdates) {
+    auto surfaceId = stateUpdate.family->getSurfaceId();
+    if (std::find(surfaceIds.begin(), surfaceIds.end(), surfaceId) ==
+        surfaceIds.end()) {
+      surfaceIds.push_back(surfaceId);
+    }
+  }
+
+  for (auto surfaceId : surfaceIds) {
+    auto families = std::vector<ShadowNodeFamily const *>{};
+    auto callbacks = better::
+        map<ShadowNodeFamily const *, StateUpdate::Callback const *>{};
+    for (auto const &stateUpdate : stateUpdates) {
+      auto family = stateUpdate.family.get();
+      if (family->getSurfaceId() == surfaceId) {
+        families.push_back(family);
+        callbacks[family] = &stateUpdate.callback;
+      }
+    }
+
+    shadowTreeRegistry_.visit(surfaceId, [&](ShadowTree const &shadowTree) {
+      shadowTree.tryCommit([&](RootShadowNode::Shared const
+                                   &oldRootShadowNode) {
+        // Shared ancestors of all updated nodes are cloned only once.
+        return std::static_pointer_cast<RootShadowNode>(
+            oldRootShadowNode->cloneTree(
+                families, [&](ShadowNode const &oldShadowNode) {
+                  auto &family = oldShadowNode.getFamily();
+                  auto &callback = *callbacks.at(&family);
+                  auto newData =
+                      callback(oldShadowNode.getState()->getDataPointer());
+                  auto newState = family.getComponentDescriptor().createState(
+                      family, newData);
+
+                  return oldShadowNode.clone({
+                      /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+                      /* .children = */
+                      ShadowNodeFragment::childrenPlaceholder(),
+                      /* .state = */ newState,
+                  });
+                }));
       });
+    });
+  }
 }
 
 void UIManager::dispatchCommand(
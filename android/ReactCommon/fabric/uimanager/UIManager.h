@@ -88,6 +88,11 @@ class UIManager final : public ShadowTreeDelegate {
 
   void clearJSResponder() const;
 
+  /*
+   * Same as `LayoutableShadowNode::findNodeAtPoint` for the newest clone of
+   * the given node. Uses the hit test index of the current revision of the
+   * shadow tree when it is available.
+   */
   ShadowNode::Shared findNodeAtPoint(
       ShadowNode::Shared const &shadowNode,
       Point point) const;
@@ -106,10 +111,18 @@ class UIManager final : public ShadowTreeDelegate {
       LayoutableShadowNode::LayoutInspectingPolicy policy) const;
 
   /*
-   * Creates a new shadow node with given state data, clones what's necessary
-   * and performs a commit.
+   * Returns layout metrics of given shadow nodes relative to root nodes of
+   * their surfaces. Results are memoized per revision of the shadow tree.
+   */
+  std::vector<LayoutMetrics> getRelativeLayoutMetrics(
+      std::vector<ShadowNode::Shared> const &shadowNodes,
+      LayoutableShadowNode::LayoutInspectingPolicy policy) const;
+
+  /*
+   * Creates new shadow nodes with given state data, clones what's necessary
+   * and performs a single commit for every affected surface.
    */
-  void updateState(StateUpdate const &stateUpdate) const;
+  void updateStates(std::vector<StateUpdate> const &stateUpdates) const;
 
   void dispatchCommand(
       const ShadowNode::Shared &shadowNode,
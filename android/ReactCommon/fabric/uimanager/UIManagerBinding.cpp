@@ -7,6 +7,9 @@
 
 #include "UIManagerBinding.h"
 
+#include <array>
+
+#include <react/core/PoolAllocator.h>
 #include <react/debug/SystraceSection.h>
 
 #include <glog/logging.h>
@@ -31,6 +34,38 @@ static jsi::Object getModule(
   return module;
 }
 
+/*
+ * Name of the property of `nativeFabricUIManager` object which retains the
+ * binding itself.
+ */
+static auto const bindingPropertyName = "__uiManagerBinding";
+
+/*
+ * Names of all methods provided by `UIManagerBinding::get`.
+ */
+static std::array<char const *, 20> const methodNames = {{
+    "createNode",
+    "cloneNode",
+    "setJSResponder",
+    "findNodeAtPoint",
+    "clearJSResponder",
+    "cloneNodeWithNewChildren",
+    "cloneNodeWithNewProps",
+    "cloneNodeWithNewChildrenAndProps",
+    "appendChild",
+    "createChildSet",
+    "appendChildToSet",
+    "completeRoot",
+    "registerEventHandler",
+    "getRelativeLayoutMetrics",
+    "dispatchCommand",
+    "measureLayout",
+    "measure",
+    "measureInWindow",
+    "measureBatch",
+    "setNativeProps",
+}};
+
 std::shared_ptr<UIManagerBinding> UIManagerBinding::createAndInstallIfNeeded(
     jsi::Runtime &runtime) {
   auto uiManagerModuleName = "nativeFabricUIManager";
@@ -40,8 +75,23 @@ std::shared_ptr<UIManagerBinding> UIManagerBinding::createAndInstallIfNeeded(
   if (uiManagerValue.isUndefined()) {
     // The global namespace does not have an instance of the binding;
     // we need to create, install and return it.
+    // The binding is installed as a plain object with all host functions
+    // created upfront, so calling a method from JavaScript is a regular
+    // property read instead of a `HostObject::get` call that creates a new
+    // function every time.
     auto uiManagerBinding = std::make_shared<UIManagerBinding>();
-    auto object = jsi::Object::createFromHostObject(runtime, uiManagerBinding);
+    auto object = jsi::Object(runtime);
+    object.setProperty(
+        runtime,
+        bindingPropertyName,
+        jsi::Object::createFromHostObject(runtime, uiManagerBinding));
+
+    auto propertyNames = uiManagerBinding->getPropertyNames(runtime);
+    for (auto const &propertyName : propertyNames) {
+      object.setProperty(
+          runtime, propertyName, uiManagerBinding->get(runtime, propertyName));
+    }
+
     runtime.global().setProperty(
         runtime, uiManagerModuleName, std::move(object));
     return uiManagerBinding;
@@ -50,7 +100,8 @@ std::shared_ptr<UIManagerBinding> UIManagerBinding::createAndInstallIfNeeded(
   // The global namespace already has an instance of the binding;
   // we need to return that.
   auto uiManagerObject = uiManagerValue.asObject(runtime);
-  return uiManagerObject.getHostObject<UIManagerBinding>(runtime);
+  return uiManagerObject.getPropertyAsObject(runtime, bindingPropertyName)
+      .getHostObject<UIManagerBinding>(runtime);
 }
 
 UIManagerBinding::~UIManagerBinding() {
@@ -160,22 +211,32 @@ void UIManagerBinding::invalidate() const {
   uiManager_->setDelegate(nullptr);
 }
 
+std::vector<jsi::PropNameID> UIManagerBinding::getPropertyNames(
+    jsi::Runtime &runtime) {
+  auto propertyNames = std::vector<jsi::PropNameID>{};
+  propertyNames.reserve(methodNames.size());
+  for (auto methodName : methodNames) {
+    propertyNames.push_back(jsi::PropNameID::forAscii(runtime, methodName));
+  }
+  return propertyNames;
+}
+
 jsi::Value UIManagerBinding::get(
     jsi::Runtime &runtime,
     const jsi::PropNameID &name) {
   auto methodName = name.utf8(runtime);
 
-  // Convert shared_ptr<UIManager> to a raw ptr
-  // Why? Because:
-  // 1) UIManagerBinding strongly retains UIManager. The JS VM
-  //    strongly retains UIManagerBinding (through the JSI).
-  //    These functions are JSI functions and are only called via
-  //    the JS VM; if the JS VM is torn down, those functions can't
+  // All functions capture a raw pointer to the binding (not `UIManager`) and
+  // read `uiManager_` on every call because they are created once, before
+  // `attach` is called.
+  // Why a raw pointer? Because:
+  // 1) The JS VM strongly retains UIManagerBinding (through the JSI object
+  //    installed as `nativeFabricUIManager`), and UIManagerBinding strongly
+  //    retains UIManager. These functions are JSI functions and are only
+  //    called via the JS VM; if the JS VM is torn down, those functions can't
   //    execute and these lambdas won't execute.
-  // 2) The UIManager is only deallocated when all references to it
-  //    are deallocated, including the UIManagerBinding. That only
-  //    happens when the JS VM is deallocated. So, the raw pointer
-  //    is safe.
+  // 2) The UIManagerBinding is only deallocated when the JS VM is
+  //    deallocated. So, the raw pointer is safe.
   //
   // Even if it's safe, why not just use shared_ptr anyway as
   //  extra insurance?
@@ -192,7 +253,6 @@ jsi::Value UIManagerBinding::get(
   //    Scheduler and JS VM. This could happen if, for instance, C++
   //    semantics cause these lambda to not be deallocated until
   //    a CPU tick (or more) after the JS VM is deallocated.
-  UIManager *uiManager = uiManager_.get();
 
   // Semantic: Creates a new node with given pieces.
   if (methodName == "createNode") {
@@ -200,14 +260,14 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         5,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
           return valueFromShadowNode(
               runtime,
-              uiManager->createNode(
+              uiManager_->createNode(
                   tagFromValue(runtime, arguments[0]),
                   stringFromValue(runtime, arguments[1]),
                   surfaceIdFromValue(runtime, arguments[2]),
@@ -222,14 +282,15 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         1,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
           return valueFromShadowNode(
               runtime,
-              uiManager->cloneNode(shadowNodeFromValue(runtime, arguments[0])));
+              uiManager_->cloneNode(
+                  shadowNodeFromValue(runtime, arguments[0])));
         });
   }
 
@@ -238,12 +299,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          uiManager->setJSResponder(
+          uiManager_->setJSResponder(
               shadowNodeFromValue(runtime, arguments[0]),
               arguments[1].getBool());
 
@@ -256,7 +317,7 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
@@ -267,7 +328,7 @@ jsi::Value UIManagerBinding::get(
           auto onSuccessFunction =
               arguments[3].getObject(runtime).getFunction(runtime);
           auto targetNode =
-              uiManager->findNodeAtPoint(node, Point{locationX, locationY});
+              uiManager_->findNodeAtPoint(node, Point{locationX, locationY});
           auto &eventTarget = targetNode->getEventEmitter()->eventTarget_;
 
           EventEmitter::DispatchMutex().lock();
@@ -286,12 +347,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         0,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          uiManager->clearJSResponder();
+          uiManager_->clearJSResponder();
 
           return jsi::Value::undefined();
         });
@@ -303,14 +364,14 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         1,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
           return valueFromShadowNode(
               runtime,
-              uiManager->cloneNode(
+              uiManager_->cloneNode(
                   shadowNodeFromValue(runtime, arguments[0]),
                   ShadowNode::emptySharedShadowNodeSharedList()));
         });
@@ -322,7 +383,7 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
@@ -330,7 +391,7 @@ jsi::Value UIManagerBinding::get(
           const auto &rawProps = RawProps(runtime, arguments[1]);
           return valueFromShadowNode(
               runtime,
-              uiManager->cloneNode(
+              uiManager_->cloneNode(
                   shadowNodeFromValue(runtime, arguments[0]),
                   nullptr,
                   &rawProps));
@@ -343,7 +404,7 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
@@ -351,7 +412,7 @@ jsi::Value UIManagerBinding::get(
           const auto &rawProps = RawProps(runtime, arguments[1]);
           return valueFromShadowNode(
               runtime,
-              uiManager->cloneNode(
+              uiManager_->cloneNode(
                   shadowNodeFromValue(runtime, arguments[0]),
                   ShadowNode::emptySharedShadowNodeSharedList(),
                   &rawProps));
@@ -363,12 +424,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          uiManager->appendChild(
+          uiManager_->appendChild(
               shadowNodeFromValue(runtime, arguments[0]),
               shadowNodeFromValue(runtime, arguments[1]));
           return jsi::Value::undefined();
@@ -384,8 +445,7 @@ jsi::Value UIManagerBinding::get(
            const jsi::Value &thisValue,
            const jsi::Value *arguments,
            size_t count) -> jsi::Value {
-          auto shadowNodeList =
-              std::make_shared<SharedShadowNodeList>(SharedShadowNodeList({}));
+          auto shadowNodeList = makePooledShared<SharedShadowNodeList>();
           return valueFromShadowNodeList(runtime, shadowNodeList);
         });
   }
@@ -411,12 +471,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          uiManager->completeSurface(
+          uiManager_->completeSurface(
               surfaceIdFromValue(runtime, arguments[0]),
               shadowNodeListFromValue(runtime, arguments[1]));
           return jsi::Value::undefined();
@@ -446,12 +506,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+          auto layoutMetrics = uiManager_->getRelativeLayoutMetrics(
               *shadowNodeFromValue(runtime, arguments[0]),
               shadowNodeFromValue(runtime, arguments[1]).get(),
               {/* .includeTransform = */ true});
@@ -470,12 +530,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         3,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          uiManager->dispatchCommand(
+          uiManager_->dispatchCommand(
               shadowNodeFromValue(runtime, arguments[0]),
               stringFromValue(runtime, arguments[1]),
               commandArgsFromValue(runtime, arguments[2]));
@@ -490,12 +550,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         4,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+          auto layoutMetrics = uiManager_->getRelativeLayoutMetrics(
               *shadowNodeFromValue(runtime, arguments[0]),
               shadowNodeFromValue(runtime, arguments[1]).get(),
               {/* .includeTransform = */ false});
@@ -526,12 +586,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+          auto layoutMetrics = uiManager_->getRelativeLayoutMetrics(
               *shadowNodeFromValue(runtime, arguments[0]),
               nullptr,
               {/* .includeTransform = */ true});
@@ -556,12 +616,12 @@ jsi::Value UIManagerBinding::get(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+          auto layoutMetrics = uiManager_->getRelativeLayoutMetrics(
               *shadowNodeFromValue(runtime, arguments[0]),
               nullptr,
               {/* .includeTransform = */ true});
@@ -580,17 +640,56 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  // Returns frames (in the same format as `getRelativeLayoutMetrics` does) of
+  // all given nodes relative to root nodes of their surfaces.
+  if (methodName == "measureBatch") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        1,
+        [this](
+            jsi::Runtime &runtime,
+            const jsi::Value &thisValue,
+            const jsi::Value *arguments,
+            size_t count) -> jsi::Value {
+          auto array = arguments[0].getObject(runtime).getArray(runtime);
+          auto size = array.size(runtime);
+
+          auto shadowNodes = std::vector<ShadowNode::Shared>{};
+          shadowNodes.reserve(size);
+          for (size_t i = 0; i < size; i++) {
+            auto value = array.getValueAtIndex(runtime, i);
+            shadowNodes.push_back(shadowNodeFromValue(runtime, value));
+          }
+
+          auto layoutMetrics = uiManager_->getRelativeLayoutMetrics(
+              shadowNodes, {/* .includeTransform = */ true});
+
+          auto result = jsi::Array(runtime, size);
+          for (size_t i = 0; i < size; i++) {
+            auto frame = layoutMetrics[i].frame;
+            auto object = jsi::Object(runtime);
+            object.setProperty(runtime, "left", frame.origin.x);
+            object.setProperty(runtime, "top", frame.origin.y);
+            object.setProperty(runtime, "width", frame.size.width);
+            object.setProperty(runtime, "height", frame.size.height);
+            result.setValueAtIndex(runtime, i, std::move(object));
+          }
+          return result;
+        });
+  }
+
   if (methodName == "setNativeProps") {
     return jsi::Function::createFromHostFunction(
         runtime,
         name,
         2,
-        [uiManager](
+        [this](
             jsi::Runtime &runtime,
             const jsi::Value &thisValue,
             const jsi::Value *arguments,
             size_t count) -> jsi::Value {
-          uiManager->setNativeProps(
+          uiManager_->setNativeProps(
               *shadowNodeFromValue(runtime, arguments[0]),
               RawProps(runtime, arguments[1]));
 
@@ -22,7 +22,8 @@ class UIManagerBinding : public jsi::HostObject {
  public:
   /*
    * Installs UIManagerBinding into JavaScript runtime if needed.
-   * Creates and sets `UIManagerBinding` into the global namespace.
+   * Creates and sets `UIManagerBinding` into the global namespace as an object
+   * holding all binding methods as plain properties.
    * In case if the global namespace already has a `UIManagerBinding` installed,
    * returns that.
    * Thread synchronization must be enforced externally.
@@ -78,6 +79,7 @@ class UIManagerBinding : public jsi::HostObject {
    * `jsi::HostObject` specific overloads.
    */
   jsi::Value get(jsi::Runtime &runtime, const jsi::PropNameID &name) override;
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime &runtime) override;
 
  private:
   std::shared_ptr<UIManager> uiManager_;
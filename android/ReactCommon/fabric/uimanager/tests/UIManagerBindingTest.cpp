@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/components/view/ViewComponentDescriptor.h>
+#include <react/config/ReactNativeConfig.h>
+#include <react/core/EventBeat.h>
+#include <react/uimanager/ComponentDescriptorProviderRegistry.h>
+#include <react/uimanager/Scheduler.h>
+#include <react/uimanager/SchedulerDelegate.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook {
+namespace react {
+
+static constexpr SurfaceId kSurfaceId = 1;
+
+class DummySchedulerDelegate : public SchedulerDelegate {
+ public:
+  void schedulerDidFinishTransaction(
+      MountingCoordinator::Shared const &mountingCoordinator) override {}
+
+  void schedulerDidRequestPreliminaryViewAllocation(
+      SurfaceId surfaceId,
+      ShadowView const &shadowView) override {}
+
+  void schedulerDidDispatchCommand(
+      ShadowView const &shadowView,
+      std::string const &commandName,
+      folly::dynamic const args) override {}
+
+  void schedulerDidSetJSResponder(
+      SurfaceId surfaceId,
+      ShadowView const &shadowView,
+      ShadowView const &initialShadowView,
+      bool blockNativeResponder) override {}
+
+  void schedulerDidClearJSResponder() override {}
+};
+
+/*
+ * Renders the same trees React does (through `nativeFabricUIManager`) into a
+ * surface started by a `Scheduler` which runs JavaScript synchronously.
+ */
+class UIManagerBindingTest : public ::testing::Test {
+ protected:
+  UIManagerBindingTest()
+      : runtime_(facebook::hermes::makeHermesRuntime()) {
+    runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(source), "test.js");
+
+    auto contextContainer = std::make_shared<ContextContainer>();
+    contextContainer->insert(
+        "ReactNativeConfig",
+        std::shared_ptr<ReactNativeConfig const>(
+            std::make_shared<EmptyReactNativeConfig const>()));
+
+    auto eventBeatFactory = [](EventBeat::SharedOwnerBox const &ownerBox) {
+      return std::make_unique<EventBeat>(ownerBox);
+    };
+
+    auto toolbox = SchedulerToolbox{};
+    toolbox.contextContainer = contextContainer;
+    toolbox.componentRegistryFactory =
+        [](EventDispatcher::Weak const &eventDispatcher,
+           ContextContainer::Shared const &contextContainer) {
+          ComponentDescriptorProviderRegistry providerRegistry{};
+          providerRegistry.add(
+              concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+          return providerRegistry.createComponentDescriptorRegistry(
+              {eventDispatcher, contextContainer});
+        };
+    toolbox.runtimeExecutor =
+        [this](std::function<void(jsi::Runtime &)> &&callback) {
+          callback(*runtime_);
+        };
+    toolbox.synchronousEventBeatFactory = eventBeatFactory;
+    toolbox.asynchronousEventBeatFactory = eventBeatFactory;
+
+    scheduler_ = std::make_unique<Scheduler>(toolbox, &schedulerDelegate_);
+
+    auto layoutConstraints = LayoutConstraints{};
+    layoutConstraints.maximumSize = {1000, 1000};
+    scheduler_->startSurface(
+        kSurfaceId, "Test", folly::dynamic::object(), layoutConstraints);
+
+    uiManagerObject_ = std::make_unique<jsi::Object>(
+        runtime_->global().getPropertyAsObject(
+            *runtime_, "nativeFabricUIManager"));
+  }
+
+  ~UIManagerBindingTest() {
+    scheduler_->stopSurface(kSurfaceId);
+    uiManagerObject_ = nullptr;
+    scheduler_ = nullptr;
+  }
+
+  jsi::Value call(
+      char const *functionName,
+      jsi::Value const &argument = jsi::Value::undefined()) {
+    return runtime_->global()
+        .getPropertyAsFunction(*runtime_, functionName)
+        .call(*runtime_, *uiManagerObject_, argument);
+  }
+
+  /*
+   * Asserts that `measureBatch` and `measure` called for every given node
+   * report the same frames and returns them.
+   */
+  jsi::Array measure(jsi::Value const &nodes) {
+    auto results = call("measureBoth", nodes).asObject(*runtime_);
+    auto batch = results.getPropertyAsObject(*runtime_, "batch")
+                     .asArray(*runtime_);
+    auto single = results.getPropertyAsObject(*runtime_, "single")
+                      .asArray(*runtime_);
+
+    EXPECT_EQ(batch.size(*runtime_), single.size(*runtime_));
+    for (size_t i = 0; i < batch.size(*runtime_); i++) {
+      auto batchFrame =
+          batch.getValueAtIndex(*runtime_, i).asObject(*runtime_);
+      auto singleFrame =
+          single.getValueAtIndex(*runtime_, i).asObject(*runtime_);
+      for (auto key : {"left", "top", "width", "height"}) {
+        EXPECT_EQ(
+            batchFrame.getProperty(*runtime_, key).asNumber(),
+            singleFrame.getProperty(*runtime_, key).asNumber())
+            << "node " << i << ", " << key;
+      }
+    }
+
+    return batch;
+  }
+
+  double frameValue(jsi::Array const &frames, size_t index, char const *key) {
+    return frames.getValueAtIndex(*runtime_, index)
+        .asObject(*runtime_)
+        .getProperty(*runtime_, key)
+        .asNumber();
+  }
+
+  static std::string const source;
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  DummySchedulerDelegate schedulerDelegate_;
+  std::unique_ptr<Scheduler> scheduler_;
+  std::unique_ptr<jsi::Object> uiManagerObject_;
+};
+
+std::string const UIManagerBindingTest::source = R"JS(
+// The surface is rendered by the test itself.
+var RN$SurfaceRegistry = {renderSurface: function() {}};
+function RN$stopSurface() {}
+
+function frameProps(left, top, width, height) {
+  return {
+    position: 'absolute',
+    left: left,
+    top: top,
+    width: width,
+    height: height,
+  };
+}
+
+// Returns [parent, child, grandchild, unmounted node, node of unknown surface].
+function render(uiManager) {
+  var parent =
+      uiManager.createNode(2, 'View', 1, frameProps(10, 20, 500, 500), {});
+  var child = uiManager.createNode(3, 'View', 1, frameProps(5, 7, 100, 40), {});
+  var grandchild =
+      uiManager.createNode(4, 'View', 1, frameProps(1, 2, 3, 4), {});
+  uiManager.appendChild(child, grandchild);
+  uiManager.appendChild(parent, child);
+
+  var childSet = uiManager.createChildSet(1);
+  uiManager.appendChildToSet(childSet, parent);
+  uiManager.completeRoot(1, childSet);
+
+  var unmounted =
+      uiManager.createNode(5, 'View', 1, frameProps(1, 1, 1, 1), {});
+  var unknownSurface =
+      uiManager.createNode(6, 'View', 2, frameProps(1, 1, 1, 1), {});
+  return [parent, child, grandchild, unmounted, unknownSurface];
+}
+
+// Resizes the child the way React commits an update.
+function update(uiManager, nodes) {
+  var child = uiManager.cloneNodeWithNewProps(nodes[1], {width: 60});
+  var parent = uiManager.cloneNodeWithNewChildren(nodes[0]);
+  uiManager.appendChild(parent, child);
+
+  var childSet = uiManager.createChildSet(1);
+  uiManager.appendChildToSet(childSet, parent);
+  uiManager.completeRoot(1, childSet);
+  return [parent, child, nodes[2], nodes[3], nodes[4]];
+}
+
+function measureBoth(uiManager, nodes) {
+  return {
+    batch: uiManager.measureBatch(nodes),
+    single: nodes.map(function(node) {
+      var frame;
+      uiManager.measure(node, function(x, y, width, height, pageX, pageY) {
+        frame = {left: pageX, top: pageY, width: width, height: height};
+      });
+      return frame;
+    }),
+  };
+}
+)JS";
+
+TEST_F(UIManagerBindingTest, measureBatchMatchesMeasure) {
+  auto nodes = call("render");
+  auto frames = measure(nodes);
+
+  EXPECT_EQ(frames.size(*runtime_), size_t{5});
+  EXPECT_EQ(frameValue(frames, 0, "left"), 10);
+  EXPECT_EQ(frameValue(frames, 0, "top"), 20);
+  EXPECT_EQ(frameValue(frames, 1, "left"), 15);
+  EXPECT_EQ(frameValue(frames, 1, "top"), 27);
+  EXPECT_EQ(frameValue(frames, 1, "width"), 100);
+  EXPECT_EQ(frameValue(frames, 2, "left"), 16);
+  EXPECT_EQ(frameValue(frames, 2, "top"), 29);
+
+  // A node that was never mounted and a node of a surface that isn't running
+  // have no layout.
+  for (size_t i : {3, 4}) {
+    EXPECT_EQ(frameValue(frames, i, "width"), 0);
+    EXPECT_EQ(frameValue(frames, i, "height"), 0);
+  }
+}
+
+TEST_F(UIManagerBindingTest, measureBatchObservesCommits) {
+  auto nodes = call("render");
+  measure(nodes);
+
+  auto updatedNodes = call("update", nodes);
+  auto frames = measure(updatedNodes);
+  EXPECT_EQ(frameValue(frames, 1, "width"), 60);
+
+  // Nodes of previous revisions are measured as their newest clones.
+  frames = measure(nodes);
+  EXPECT_EQ(frameValue(frames, 1, "width"), 60);
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/components/view/ViewComponentDescriptor.h>
+#include <react/uimanager/ComponentDescriptorProviderRegistry.h>
+#include <react/uimanager/UIManager.h>
+#include <react/uimanager/UIManagerBinding.h>
+#include <react/utils/ContextContainer.h>
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Measures throughput of `createNode`/`appendChild` calls made from JavaScript
+ * the way React does it during render.
+ * `nativeFabricUIManager` holds the host functions as plain properties;
+ * `nativeFabricUIManager.__uiManagerBinding` is the underlying `HostObject`
+ * which creates a new function on every property read, so it shows the cost
+ * of the dispatch the plain properties avoid.
+ */
+
+static auto const buildTreeSource = std::string{R"JS(
+function buildTree(uiManager, childCount) {
+  var parent = uiManager.createNode(1, 'View', 1, {}, {});
+  for (var i = 0; i < childCount; i++) {
+    var child = uiManager.createNode(i + 2, 'View', 1, {}, {});
+    uiManager.appendChild(parent, child);
+  }
+  return parent;
+}
+)JS"};
+
+static auto const providerRegistry = [] {
+  auto registry = std::make_shared<ComponentDescriptorProviderRegistry>();
+  registry->add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  return registry;
+}();
+
+static void runBuildTree(benchmark::State &state, bool useHostObject) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto uiManager = std::make_shared<UIManager>();
+  uiManager->setComponentDescriptorRegistry(
+      providerRegistry->createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              EventDispatcher::Shared{},
+              std::make_shared<ContextContainer const>()}));
+
+  auto uiManagerBinding =
+      UIManagerBinding::createAndInstallIfNeeded(*runtime);
+  uiManagerBinding->attach(uiManager);
+
+  runtime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>(buildTreeSource), "benchmark.js");
+  auto buildTree =
+      runtime->global().getPropertyAsFunction(*runtime, "buildTree");
+  auto uiManagerObject =
+      runtime->global().getPropertyAsObject(*runtime, "nativeFabricUIManager");
+  if (useHostObject) {
+    uiManagerObject =
+        uiManagerObject.getPropertyAsObject(*runtime, "__uiManagerBinding");
+  }
+
+  auto childCount = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    buildTree.call(*runtime, uiManagerObject, childCount);
+  }
+  state.SetItemsProcessed(state.iterations() * (childCount * 2 + 1));
+
+  uiManagerBinding->attach(nullptr);
+}
+
+static void buildTreeWithPlainProperties(benchmark::State &state) {
+  runBuildTree(state, false);
+}
+BENCHMARK(buildTreeWithPlainProperties)->Arg(100)->Arg(1000);
+
+static void buildTreeWithHostObject(benchmark::State &state) {
+  runBuildTree(state, true);
+}
+BENCHMARK(buildTreeWithHostObject)->Arg(100)->Arg(1000);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
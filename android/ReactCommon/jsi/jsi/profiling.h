@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include <jsi/decorator.h>
+#include <jsi/jsi.h>
+
+// This file contains a runtime decorator which measures the cost of
+// crossing the JSI boundary, i.e. of calls from JavaScript into host
+// functions and host objects, so that the most expensive bindings can
+// be found in production-like builds.
+
+namespace facebook {
+namespace jsi {
+
+/// Statistics of one JS -> native entry point: a host function, or a
+/// property of a host object (gets and sets are counted separately).
+struct ProfilingRecord {
+  std::string name;
+  uint64_t count = 0;
+  std::chrono::nanoseconds totalDuration{0};
+  std::chrono::nanoseconds maxDuration{0};
+  // Number of arguments passed to the host function (or 1 for sets).
+  uint64_t argumentCount = 0;
+  // Total size of string arguments, in UTF-8 bytes.
+  uint64_t argumentBytes = 0;
+};
+
+/// Collects records and (optionally) trace events.  Can be read from
+/// any thread while the runtime is in use.
+class Profiler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  Profiler() : epoch_(Clock::now()) {}
+
+  /// Records one call of the entry point with the given name.
+  void recordCall(
+      const std::string& name,
+      Clock::time_point start,
+      Clock::time_point end,
+      size_t argumentCount,
+      size_t argumentBytes) {
+    auto duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& record = records_[name];
+    if (record.count == 0) {
+      record.name = name;
+    }
+    record.count++;
+    record.totalDuration += duration;
+    record.maxDuration = std::max(record.maxDuration, duration);
+    record.argumentCount += argumentCount;
+    record.argumentBytes += argumentBytes;
+    jsToNativeCallCount_++;
+
+    if (traceEvents_.size() < maxTraceEventCount_) {
+      traceEvents_.push_back(TraceEvent{name, start, end});
+    }
+  }
+
+  /// Records one call from native code into JavaScript.
+  void recordNativeToJSCall() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    nativeToJSCallCount_++;
+  }
+
+  /// Starts recording every call (up to \c maxEventCount of them) for
+  /// \c getTrace().
+  void startTracing(size_t maxEventCount) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxTraceEventCount_ = maxEventCount;
+    traceEvents_.reserve(std::min<size_t>(maxEventCount, 4096));
+  }
+
+  /// Stops recording calls for \c getTrace(); recorded calls are kept.
+  void stopTracing() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxTraceEventCount_ = 0;
+  }
+
+  /// Forgets all records and trace events.
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.clear();
+    traceEvents_.clear();
+    jsToNativeCallCount_ = 0;
+    nativeToJSCallCount_ = 0;
+  }
+
+  /// Returns all records, the most expensive (by total duration) first.
+  std::vector<ProfilingRecord> getRecords() const {
+    std::vector<ProfilingRecord> records;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      records.reserve(records_.size());
+      for (const auto& pair : records_) {
+        records.push_back(pair.second);
+      }
+    }
+
+    std::sort(
+        records.begin(),
+        records.end(),
+        [](const ProfilingRecord& lhs, const ProfilingRecord& rhs) {
+          return lhs.totalDuration > rhs.totalDuration;
+        });
+    return records;
+  }
+
+  uint64_t getJSToNativeCallCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return jsToNativeCallCount_;
+  }
+
+  uint64_t getNativeToJSCallCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nativeToJSCallCount_;
+  }
+
+  /// Returns a human-readable table of all records.
+  std::string getReport() const {
+    auto records = getRecords();
+
+    std::ostringstream stream;
+    stream << "JS -> native calls: " << getJSToNativeCallCount() << "\n";
+    stream << "native -> JS calls: " << getNativeToJSCallCount() << "\n";
+    stream << "count\ttotal (us)\tmax (us)\targs\targ bytes\tname\n";
+    for (const auto& record : records) {
+      stream << record.count << "\t" << toMicroseconds(record.totalDuration)
+             << "\t" << toMicroseconds(record.maxDuration) << "\t"
+             << record.argumentCount << "\t" << record.argumentBytes << "\t"
+             << record.name << "\n";
+    }
+    return stream.str();
+  }
+
+  /// Returns recorded calls in the Trace Event Format (JSON), which can
+  /// be loaded into chrome://tracing or Perfetto.
+  std::string getTrace() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::ostringstream stream;
+    stream << "{\"traceEvents\":[";
+    for (size_t i = 0; i < traceEvents_.size(); i++) {
+      const auto& event = traceEvents_[i];
+      stream << (i == 0 ? "" : ",") << "{\"name\":\"";
+      writeEscaped(stream, event.name);
+      stream << "\",\"cat\":\"jsi\",\"ph\":\"X\",\"pid\":0,\"tid\":0"
+             << ",\"ts\":" << toMicroseconds(event.start - epoch_)
+             << ",\"dur\":" << toMicroseconds(event.end - event.start) << "}";
+    }
+    stream << "]}";
+    return stream.str();
+  }
+
+ private:
+  struct TraceEvent {
+    std::string name;
+    Clock::time_point start;
+    Clock::time_point end;
+  };
+
+  static double toMicroseconds(Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  }
+
+  static void writeEscaped(std::ostream& stream, const std::string& string) {
+    for (char c : string) {
+      if (c == '"' || c == '\\') {
+        stream << '\\' << c;
+      } else if (static_cast<unsigned char>(c) >= 0x20) {
+        stream << c;
+      }
+    }
+  }
+
+  const Clock::time_point epoch_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, ProfilingRecord> records_;
+  std::vector<TraceEvent> traceEvents_;
+  size_t maxTraceEventCount_ = 0;
+  uint64_t jsToNativeCallCount_ = 0;
+  uint64_t nativeToJSCallCount_ = 0;
+};
+
+namespace detail {
+
+// Records a call when it goes out of scope, so that calls which throw
+// are recorded as well.
+class ProfilingScope {
+ public:
+  ProfilingScope(
+      Profiler& profiler,
+      const std::string& name,
+      size_t argumentCount,
+      size_t argumentBytes)
+      : profiler_(profiler),
+        name_(name),
+        argumentCount_(argumentCount),
+        argumentBytes_(argumentBytes),
+        start_(Profiler::Clock::now()) {}
+
+  ~ProfilingScope() {
+    profiler_.recordCall(
+        name_, start_, Profiler::Clock::now(), argumentCount_, argumentBytes_);
+  }
+
+ private:
+  Profiler& profiler_;
+  const std::string& name_;
+  size_t argumentCount_;
+  size_t argumentBytes_;
+  Profiler::Clock::time_point start_;
+};
+
+inline size_t getArgumentBytes(Runtime& rt, const Value* args, size_t count) {
+  size_t bytes = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (args[i].isString()) {
+      bytes += args[i].getString(rt).utf8(rt).size();
+    }
+  }
+  return bytes;
+}
+
+// Wraps a host function; the runtime it gets is the decorated one.
+class ProfilingHostFunction {
+ public:
+  ProfilingHostFunction(
+      std::shared_ptr<Profiler> profiler,
+      std::string name,
+      HostFunctionType plainHF)
+      : profiler_(std::move(profiler)),
+        name_(std::move(name)),
+        plainHF_(std::move(plainHF)) {}
+
+  Value operator()(
+      Runtime& rt,
+      const Value& thisVal,
+      const Value* args,
+      size_t count) {
+    ProfilingScope scope(
+        *profiler_, name_, count, getArgumentBytes(rt, args, count));
+    return plainHF_(rt, thisVal, args, count);
+  }
+
+  HostFunctionType& plainHostFunction() {
+    return plainHF_;
+  }
+
+ private:
+  std::shared_ptr<Profiler> profiler_;
+  std::string name_;
+  HostFunctionType plainHF_;
+};
+
+class ProfilingHostObject : public DecoratedHostObject {
+ public:
+  ProfilingHostObject(
+      Runtime& drt,
+      std::shared_ptr<HostObject> plainHO,
+      std::shared_ptr<Profiler> profiler)
+      : DecoratedHostObject(drt, plainHO),
+        profiler_(std::move(profiler)),
+        name_(typeid(*plainHO).name()) {}
+
+  Value get(Runtime& rt, const PropNameID& name) override {
+    auto recordName = name_ + ".get:" + name.utf8(decoratedRuntime());
+    ProfilingScope scope(*profiler_, recordName, 0, 0);
+    return DecoratedHostObject::get(rt, name);
+  }
+
+  void set(Runtime& rt, const PropNameID& name, const Value& value) override {
+    auto recordName = name_ + ".set:" + name.utf8(decoratedRuntime());
+    ProfilingScope scope(
+        *profiler_,
+        recordName,
+        1,
+        getArgumentBytes(decoratedRuntime(), &value, 1));
+    DecoratedHostObject::set(rt, name, value);
+  }
+
+  std::vector<PropNameID> getPropertyNames(Runtime& rt) override {
+    auto recordName = name_ + ".getPropertyNames";
+    ProfilingScope scope(*profiler_, recordName, 0, 0);
+    return DecoratedHostObject::getPropertyNames(rt);
+  }
+
+ private:
+  std::shared_ptr<Profiler> profiler_;
+  std::string name_;
+};
+
+} // namespace detail
+
+/// A runtime decorator which records every call of a host function and
+/// every access to a property of a host object made through it (count,
+/// total and maximum latency, and argument sizes), as well as the
+/// number of calls from native code into JavaScript.  Host functions
+/// are named after the name they were created with; host objects are
+/// named after their (mangled) C++ type.  Latencies are inclusive, i.e.
+/// include nested calls back into JavaScript.
+///
+/// Host functions and host objects have to be created through the
+/// decorated runtime to be profiled.
+class ProfilingRuntime : public RuntimeDecorator<Runtime> {
+ public:
+  using RD = RuntimeDecorator<Runtime>;
+
+  explicit ProfilingRuntime(Runtime& plain)
+      : RD(plain), profiler_(std::make_shared<Profiler>()) {}
+
+  explicit ProfilingRuntime(std::unique_ptr<Runtime> plain)
+      : RD(*plain),
+        ownedPlain_(std::move(plain)),
+        profiler_(std::make_shared<Profiler>()) {}
+
+  Profiler& profiler() {
+    return *profiler_;
+  }
+
+  Value evaluateJavaScript(
+      const std::shared_ptr<const Buffer>& buffer,
+      const std::string& sourceURL) override {
+    profiler_->recordNativeToJSCall();
+    return RD::evaluateJavaScript(buffer, sourceURL);
+  }
+  Value evaluatePreparedJavaScript(
+      const std::shared_ptr<const PreparedJavaScript>& js) override {
+    profiler_->recordNativeToJSCall();
+    return RD::evaluatePreparedJavaScript(js);
+  }
+
+ protected:
+  Object createObject(std::shared_ptr<HostObject> ho) override {
+    return Object::createFromHostObject(
+        plain(),
+        std::make_shared<detail::ProfilingHostObject>(
+            *this, std::move(ho), profiler_));
+  }
+
+  Function createFunctionFromHostFunction(
+      const PropNameID& name,
+      unsigned int paramCount,
+      HostFunctionType func) override {
+    return RD::createFunctionFromHostFunction(
+        name,
+        paramCount,
+        detail::ProfilingHostFunction(
+            profiler_, name.utf8(plain()), std::move(func)));
+  }
+  HostFunctionType& getHostFunction(const jsi::Function& f) override {
+    return RD::getHostFunction(f)
+        .target<detail::ProfilingHostFunction>()
+        ->plainHostFunction();
+  }
+
+  Value call(
+      const Function& f,
+      const Value& jsThis,
+      const Value* args,
+      size_t count) override {
+    profiler_->recordNativeToJSCall();
+    return RD::call(f, jsThis, args, count);
+  }
+  Value callAsConstructor(const Function& f, const Value* args, size_t count)
+      override {
+    profiler_->recordNativeToJSCall();
+    return RD::callAsConstructor(f, args, count);
+  }
+
+ private:
+  std::unique_ptr<Runtime> ownedPlain_;
+  std::shared_ptr<Profiler> profiler_;
+};
+
+} // namespace jsi
+} // namespace facebook
@@ -9,6 +9,7 @@
 #include <gtest/gtest.h>
 #include <jsi/decorator.h>
 #include <jsi/jsi.h>
+#include <jsi/profiling.h>
 
 #include <stdlib.h>
 #include <chrono>
@@ -1353,6 +1354,72 @@ TEST_P(JSITest, MultilevelDecoratedHostObject) {
   EXPECT_EQ(1, RD2::numGets);
 }
 
+TEST_P(JSITest, ProfilingRuntimeTest) {
+  class PropertyHostObject : public HostObject {
+   public:
+    Value get(Runtime&, const PropNameID&) override {
+      return Value(17.0);
+    }
+  };
+
+  ProfilingRuntime prt(factory());
+
+  Function concat = Function::createFromHostFunction(
+      prt,
+      PropNameID::forAscii(prt, "concat"),
+      2,
+      [](Runtime& rt, const Value&, const Value* args, size_t count) {
+        std::string result;
+        for (size_t i = 0; i < count; i++) {
+          result += args[i].getString(rt).utf8(rt);
+        }
+        return String::createFromUtf8(rt, result);
+      });
+  prt.global().setProperty(prt, "concat", concat);
+  prt.global().setProperty(
+      prt,
+      "ho",
+      Object::createFromHostObject(
+          prt, std::make_shared<PropertyHostObject>()));
+
+  prt.profiler().startTracing(100);
+  prt.evaluateJavaScript(
+      std::make_unique<StringBuffer>(
+          "for (var i = 0; i < 3; i++) { concat('ab', 'cde'); ho.p; }"),
+      "");
+
+  EXPECT_EQ(prt.profiler().getJSToNativeCallCount(), 6);
+  EXPECT_EQ(prt.profiler().getNativeToJSCallCount(), 1);
+
+  auto records = prt.profiler().getRecords();
+  EXPECT_EQ(records.size(), 2);
+  for (const auto& record : records) {
+    EXPECT_EQ(record.count, 3);
+    EXPECT_LE(record.maxDuration, record.totalDuration);
+    if (record.name == "concat") {
+      EXPECT_EQ(record.argumentCount, 6);
+      EXPECT_EQ(record.argumentBytes, 15);
+    } else {
+      EXPECT_NE(record.name.find(".get:p"), std::string::npos);
+      EXPECT_EQ(record.argumentCount, 0);
+    }
+  }
+
+  // The original host function is still accessible.
+  EXPECT_TRUE(concat.isHostFunction(prt));
+  EXPECT_EQ(
+      concat.getHostFunction(prt)(prt, Value::undefined(), nullptr, 0)
+          .getString(prt)
+          .utf8(prt),
+      "");
+
+  EXPECT_NE(prt.profiler().getReport().find("concat"), std::string::npos);
+  EXPECT_NE(prt.profiler().getTrace().find("\"ph\":\"X\""), std::string::npos);
+
+  prt.profiler().reset();
+  EXPECT_TRUE(prt.profiler().getRecords().empty());
+}
+
 INSTANTIATE_TEST_CASE_P(
     Runtimes,
     JSITest,
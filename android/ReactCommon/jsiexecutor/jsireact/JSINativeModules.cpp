@@ -14,12 +14,231 @@
 #include <jsi/JSIDynamic.h>
 
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace facebook::jsi;
 
 namespace facebook {
 namespace react {
 
+namespace {
+
+Object genNativeModule(
+    Runtime &rt,
+    const Function &genNativeModuleJS,
+    const folly::dynamic &config,
+    size_t index) {
+  Value moduleInfo = genNativeModuleJS.call(
+      rt, valueFromDynamic(rt, config), static_cast<double>(index));
+  CHECK(!moduleInfo.isNull()) << "Module returned from genNativeModule is null";
+
+  return moduleInfo.asObject(rt).getPropertyAsObject(rt, "module");
+}
+
+} // namespace
+
+/**
+ * The state of a module which is exposed as a host object: its methods
+ * (generated by `__fbGenNativeModule` from a config without constants), the
+ * constants once they are generated, and the properties which were already
+ * converted to JS values.
+ *
+ * Differences from the plain object `__fbGenNativeModule` creates:
+ * - A method shadows a constant with the same name (the plain object lets the
+ *   constant win), because that would require generating constants on the
+ *   first method call.
+ * - Names which are neither methods nor constants are looked up on
+ *   `Object.prototype` (e.g. `hasOwnProperty`); a method or constant named
+ *   like one of its properties hides it, as on the plain object.
+ * Object-valued constants keep their identity:
+ * `module.FOO === module.getConstants().FOO`.
+ */
+class JSINativeModules::LazyModule
+    : public std::enable_shared_from_this<LazyModule> {
+ public:
+  LazyModule(
+      Runtime &rt,
+      std::shared_ptr<ModuleRegistry> moduleRegistry,
+      size_t index,
+      const Object &module,
+      const folly::dynamic &methodNames)
+      : m_moduleRegistry(std::move(moduleRegistry)), m_index(index) {
+    // `__fbGenNativeModule` has created all methods already, so they are
+    // resolved once here. Only the native method names are looked up, so
+    // neither `Object.prototype` nor the `getConstants` generated in JS
+    // (which knows no constants) can leak in.
+    m_properties.reserve(methodNames.size() + 1);
+    for (const auto &methodName : methodNames) {
+      auto name = PropNameID::forUtf8(rt, methodName.getString());
+      auto value = module.getProperty(rt, name);
+      m_properties.emplace_back(std::move(name), std::move(value));
+    }
+  }
+
+  Value get(Runtime &rt, const PropNameID &name) {
+    // Methods are read on every call from JS, so the lookup compares the
+    // names directly instead of converting them to strings for hashing.
+    for (const auto &property : m_properties) {
+      if (PropNameID::compare(rt, property.first, name)) {
+        return Value(rt, property.second);
+      }
+    }
+
+    auto key = name.utf8(rt);
+    Value value;
+    if (key == "getConstants") {
+      std::weak_ptr<LazyModule> weakThis = shared_from_this();
+      value = Function::createFromHostFunction(
+          rt,
+          name,
+          0,
+          [weakThis](
+              Runtime &runtime, const Value &, const Value *, size_t) {
+            auto strongThis = weakThis.lock();
+            if (!strongThis) {
+              return Value::undefined();
+            }
+            return Value(runtime, strongThis->getConstantsObject(runtime));
+          });
+    } else {
+      const auto &constants = getConstants();
+      if (!constants.isObject() || !constants.get_ptr(key)) {
+        // Not cached, so later changes to `Object.prototype` are visible.
+        return rt.global()
+            .getPropertyAsObject(rt, "Object")
+            .getPropertyAsObject(rt, "prototype")
+            .getProperty(rt, name);
+      }
+      value = getConstant(rt, key);
+    }
+
+    m_properties.emplace_back(PropNameID(rt, name), Value(rt, value));
+    return value;
+  }
+
+  void set(Runtime &rt, const PropNameID &name, const Value &value) {
+    for (auto &property : m_properties) {
+      if (PropNameID::compare(rt, property.first, name)) {
+        property.second = Value(rt, value);
+        return;
+      }
+    }
+    m_properties.emplace_back(PropNameID(rt, name), Value(rt, value));
+  }
+
+  std::vector<PropNameID> getPropertyNames(Runtime &rt) {
+    std::unordered_set<std::string> keys{"getConstants"};
+
+    for (const auto &property : m_properties) {
+      keys.insert(property.first.utf8(rt));
+    }
+
+    const auto &constants = getConstants();
+    if (constants.isObject()) {
+      for (const auto &key : constants.keys()) {
+        keys.insert(key.asString());
+      }
+    }
+
+    std::vector<PropNameID> names;
+    names.reserve(keys.size());
+    for (const auto &key : keys) {
+      names.push_back(PropNameID::forUtf8(rt, key));
+    }
+    return names;
+  }
+
+ private:
+  std::shared_ptr<ModuleRegistry> m_moduleRegistry;
+  size_t m_index;
+  std::vector<std::pair<PropNameID, Value>> m_properties;
+  folly::Optional<folly::dynamic> m_constants;
+
+  // Constants converted before `getConstants` was called; the constants
+  // object reuses them, afterwards it is the only source of constants.
+  std::unordered_map<std::string, Value> m_constantValues;
+  folly::Optional<Object> m_constantsObject;
+
+  const folly::dynamic &getConstants() {
+    if (!m_constants.hasValue()) {
+      m_constants = m_moduleRegistry->getConstants(m_index);
+    }
+    return *m_constants;
+  }
+
+  Value getConstant(Runtime &rt, const std::string &key) {
+    if (m_constantsObject.hasValue()) {
+      return m_constantsObject->getProperty(rt, key.c_str());
+    }
+
+    auto it = m_constantValues.find(key);
+    if (it == m_constantValues.end()) {
+      it = m_constantValues
+               .emplace(key, valueFromDynamic(rt, getConstants()[key]))
+               .first;
+    }
+    return Value(rt, it->second);
+  }
+
+  const Object &getConstantsObject(Runtime &rt) {
+    if (!m_constantsObject.hasValue()) {
+      Object constantsObject(rt);
+      const auto &constants = getConstants();
+      if (constants.isObject()) {
+        for (const auto &item : constants.items()) {
+          auto key = item.first.asString();
+          auto it = m_constantValues.find(key);
+          constantsObject.setProperty(
+              rt,
+              key.c_str(),
+              it != m_constantValues.end()
+                  ? Value(rt, it->second)
+                  : valueFromDynamic(rt, item.second));
+        }
+      }
+      m_constantsObject = std::move(constantsObject);
+      m_constantValues.clear();
+    }
+    return *m_constantsObject;
+  }
+};
+
+/**
+ * Forwards to a `LazyModule`, which is owned by `JSINativeModules`.
+ */
+class JSINativeModules::LazyModuleHostObject : public HostObject {
+ public:
+  LazyModuleHostObject(std::shared_ptr<LazyModule> lazyModule)
+      : m_weakLazyModule(lazyModule) {}
+
+  Value get(Runtime &rt, const PropNameID &name) override {
+    auto lazyModule = m_weakLazyModule.lock();
+    if (!lazyModule) {
+      return Value::undefined();
+    }
+    return lazyModule->get(rt, name);
+  }
+
+  void set(Runtime &rt, const PropNameID &name, const Value &value) override {
+    auto lazyModule = m_weakLazyModule.lock();
+    if (lazyModule) {
+      lazyModule->set(rt, name, value);
+    }
+  }
+
+  std::vector<PropNameID> getPropertyNames(Runtime &rt) override {
+    auto lazyModule = m_weakLazyModule.lock();
+    if (!lazyModule) {
+      return {};
+    }
+    return lazyModule->getPropertyNames(rt);
+  }
+
+ private:
+  std::weak_ptr<LazyModule> m_weakLazyModule;
+};
+
 JSINativeModules::JSINativeModules(
     std::shared_ptr<ModuleRegistry> moduleRegistry)
     : m_moduleRegistry(std::move(moduleRegistry)) {}
@@ -51,6 +270,7 @@ Value JSINativeModules::getModule(Runtime &rt, const PropNameID &name) {
 void JSINativeModules::reset() {
   m_genNativeModuleJS = folly::none;
   m_objects.clear();
+  m_lazyModules.clear();
 }
 
 folly::Optional<Object> JSINativeModules::createModule(
@@ -67,19 +287,48 @@ folly::Optional<Object> JSINativeModules::createModule(
         rt.global().getPropertyAsFunction(rt, "__fbGenNativeModule");
   }
 
-  auto result = m_moduleRegistry->getConfig(name);
-  if (!result.hasValue()) {
+  auto index = m_moduleRegistry->getModuleIndex(name);
+  if (!index.hasValue()) {
     return folly::none;
   }
 
-  Value moduleInfo = m_genNativeModuleJS->call(
-      rt,
-      valueFromDynamic(rt, result->config),
-      static_cast<double>(result->index));
-  CHECK(!moduleInfo.isNull()) << "Module returned from genNativeModule is null";
+  auto methodsConfig = m_moduleRegistry->getMethodsConfig(*index);
+
+  folly::Optional<Object> module;
+  if (methodsConfig.empty()) {
+    // A module without methods is only used for its constants, so there is
+    // nothing to defer.
+    auto constants = m_moduleRegistry->getConstants(*index);
+    if (constants.empty()) {
+      // no constants or methods
+      return folly::none;
+    }
 
-  folly::Optional<Object> module(
-      moduleInfo.asObject(rt).getPropertyAsObject(rt, "module"));
+    module = genNativeModule(
+        rt,
+        *m_genNativeModuleJS,
+        folly::dynamic::array(name, std::move(constants)),
+        *index);
+  } else {
+    // string name, object constants (null, these are generated lazily),
+    // array methodNames, [array promiseMethodIds], [array syncMethodIds]
+    folly::dynamic config = folly::dynamic::array(name, nullptr);
+    for (auto &item : methodsConfig) {
+      config.push_back(std::move(item));
+    }
+
+    // The method table stays eager: `__fbGenNativeModule` creates a JS
+    // function for every method of the module right away.
+    auto lazyModule = std::make_shared<LazyModule>(
+        rt,
+        m_moduleRegistry,
+        *index,
+        genNativeModule(rt, *m_genNativeModuleJS, config, *index),
+        config[2]);
+    m_lazyModules.push_back(lazyModule);
+    module = Object::createFromHostObject(
+        rt, std::make_shared<LazyModuleHostObject>(std::move(lazyModule)));
+  }
 
   if (hasLogger) {
     ReactMarker::logTaggedMarker(
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <cxxreact/ModuleRegistry.h>
 #include <folly/Optional.h>
@@ -19,6 +20,14 @@ namespace react {
 
 /**
  * Holds and creates JS representations of the modules in ModuleRegistry
+ *
+ * Modules with methods are exposed as host objects: their constants are
+ * generated only when JS first accesses one of them (or calls
+ * `getConstants`), and each constant is converted to a JS value on its first
+ * access. Many modules are required only to call their methods, so this
+ * saves generating and converting their constants during startup. Methods
+ * are still generated when the module is first required. A method shadows a
+ * constant with the same name (see `LazyModule`).
  */
 class JSINativeModules {
  public:
@@ -27,10 +36,17 @@ class JSINativeModules {
   void reset();
 
  private:
+  class LazyModule;
+  class LazyModuleHostObject;
+
   folly::Optional<jsi::Function> m_genNativeModuleJS;
   std::shared_ptr<ModuleRegistry> m_moduleRegistry;
   std::unordered_map<std::string, jsi::Object> m_objects;
 
+  // Owns the state of the host objects, so that the JS values it holds are
+  // released together with m_objects (host objects can outlive this class).
+  std::vector<std::shared_ptr<LazyModule>> m_lazyModules;
+
   folly::Optional<jsi::Object> createModule(
       jsi::Runtime &rt,
       const std::string &name);
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <jsireact/JSINativeModules.h>
+
+#include "NativeModuleFixtures.h"
+
+namespace facebook {
+namespace react {
+
+class JSINativeModulesTest : public ::testing::Test {
+ protected:
+  JSINativeModulesTest() : runtime_(facebook::hermes::makeHermesRuntime()) {
+    std::vector<std::unique_ptr<NativeModule>> modules;
+    auto module = std::make_unique<FakeNativeModule>(
+        "Networking",
+        std::vector<std::string>{"sendRequest", "abort", "toString"},
+        folly::dynamic::object("version", 2)(
+            "limits", folly::dynamic::object("timeout", 30))(
+            "constructor", "Networking")("abort", "constant"));
+    module_ = module.get();
+    modules.push_back(std::move(module));
+
+    nativeModules_ = std::make_shared<JSINativeModules>(
+        std::make_shared<ModuleRegistry>(std::move(modules)));
+
+    runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(kGenNativeModuleSource),
+        "NativeModules.js");
+    runtime_->global().setProperty(
+        *runtime_,
+        "Networking",
+        nativeModules_->getModule(
+            *runtime_, jsi::PropNameID::forAscii(*runtime_, "Networking")));
+  }
+
+  ~JSINativeModulesTest() {
+    runtime_->global().setProperty(
+        *runtime_, "Networking", jsi::Value::undefined());
+    nativeModules_->reset();
+  }
+
+  jsi::Value evaluate(std::string const &source) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(source), "test.js");
+  }
+
+  std::string evaluateString(std::string const &source) {
+    return evaluate(source).asString(*runtime_).utf8(*runtime_);
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::shared_ptr<JSINativeModules> nativeModules_;
+  FakeNativeModule *module_;
+};
+
+TEST_F(JSINativeModulesTest, generatesConstantsOnFirstAccess) {
+  EXPECT_EQ(evaluateString("Networking.sendRequest()"), "sendRequest");
+  EXPECT_EQ(module_->getConstantsCount, 0);
+
+  EXPECT_EQ(evaluate("Networking.version").asNumber(), 2);
+  EXPECT_EQ(evaluate("Networking.limits.timeout").asNumber(), 30);
+  EXPECT_TRUE(evaluate("Networking.unknown").isUndefined());
+  EXPECT_EQ(module_->getConstantsCount, 1);
+}
+
+TEST_F(JSINativeModulesTest, getConstantsReturnsAllConstants) {
+  EXPECT_EQ(
+      evaluateString("Object.keys(Networking.getConstants()).sort().join()"),
+      "abort,constructor,limits,version");
+  EXPECT_EQ(evaluate("Networking.getConstants().version").asNumber(), 2);
+  EXPECT_TRUE(
+      evaluate("Networking.getConstants() === Networking.getConstants()")
+          .getBool());
+}
+
+TEST_F(JSINativeModulesTest, keepsIdentityOfObjectConstants) {
+  // Read before and after the constants object is created.
+  EXPECT_TRUE(evaluate("var limits = Networking.limits;"
+                       "limits === Networking.getConstants().limits && "
+                       "limits === Networking.limits")
+                  .getBool());
+}
+
+TEST_F(JSINativeModulesTest, setsProperties) {
+  evaluate("Networking.version = 3; Networking.sendRequest = 42;");
+  EXPECT_EQ(evaluate("Networking.version").asNumber(), 3);
+  EXPECT_EQ(evaluate("Networking.sendRequest").asNumber(), 42);
+  EXPECT_EQ(evaluate("Networking.getConstants().version").asNumber(), 2);
+
+  evaluate("Networking.custom = 'value';");
+  EXPECT_EQ(evaluateString("Networking.custom"), "value");
+}
+
+TEST_F(JSINativeModulesTest, enumeratesMethodsAndConstants) {
+  evaluate("Networking.custom = 'value';");
+  EXPECT_EQ(
+      evaluateString("Object.keys(Networking).sort().join(',')"),
+      "abort,constructor,custom,getConstants,limits,sendRequest,toString,"
+      "version");
+}
+
+TEST_F(JSINativeModulesTest, fallsBackToObjectPrototype) {
+  // `Object.prototype.constructor` does not hide the constant and the
+  // method is not `Object.prototype.toString`.
+  EXPECT_EQ(evaluateString("Networking.constructor"), "Networking");
+  EXPECT_EQ(evaluateString("Networking.toString()"), "toString");
+  EXPECT_TRUE(
+      evaluate("Networking.hasOwnProperty === Object.prototype.hasOwnProperty")
+          .getBool());
+  EXPECT_TRUE(
+      evaluate("Networking.valueOf === Object.prototype.valueOf").getBool());
+  EXPECT_TRUE(evaluate("Networking.unknown").isUndefined());
+}
+
+TEST_F(JSINativeModulesTest, methodsShadowConstantsWithTheSameName) {
+  EXPECT_EQ(evaluateString("Networking.abort()"), "abort");
+  EXPECT_EQ(evaluateString("Networking.getConstants().abort"), "constant");
+}
+
+} // namespace react
+} // namespace facebook
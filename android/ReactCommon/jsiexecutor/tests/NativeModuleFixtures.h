@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cxxreact/NativeModule.h>
+#include <folly/dynamic.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Same as `genModule` of `NativeModules.js` (which installs itself as
+ * `__fbGenNativeModule`), with methods that return their own names.
+ */
+static char const *const kGenNativeModuleSource = R"JS(
+function __fbGenNativeModule(config, moduleID) {
+  var moduleName = config[0];
+  var constants = config[1];
+  var methods = config[2];
+  if (!constants && !methods) {
+    return {name: moduleName};
+  }
+
+  var module = {};
+  (methods || []).forEach(function(methodName) {
+    module[methodName] = function() {
+      return methodName;
+    };
+  });
+  Object.assign(module, constants);
+  if (module.getConstants == null) {
+    module.getConstants = function() {
+      return constants || Object.freeze({});
+    };
+  }
+  return {name: moduleName, module: module};
+}
+)JS";
+
+class FakeNativeModule : public NativeModule {
+ public:
+  FakeNativeModule(
+      std::string name,
+      std::vector<std::string> methodNames,
+      folly::dynamic constants)
+      : name_(std::move(name)),
+        methodNames_(std::move(methodNames)),
+        constants_(std::move(constants)) {}
+
+  std::string getName() override {
+    return name_;
+  }
+
+  std::vector<MethodDescriptor> getMethods() override {
+    std::vector<MethodDescriptor> methods;
+    for (const auto &methodName : methodNames_) {
+      methods.emplace_back(methodName, "async");
+    }
+    return methods;
+  }
+
+  folly::dynamic getConstants() override {
+    getConstantsCount++;
+    return constants_;
+  }
+
+  void invoke(unsigned int, folly::dynamic &&, int) override {}
+
+  MethodCallResult callSerializableNativeHook(
+      unsigned int,
+      folly::dynamic &&) override {
+    return folly::none;
+  }
+
+  int getConstantsCount{0};
+
+ private:
+  std::string name_;
+  std::vector<std::string> methodNames_;
+  folly::dynamic constants_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/Conv.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <jsireact/JSINativeModules.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../NativeModuleFixtures.h"
+
+namespace facebook {
+namespace react {
+
+/*
+ * Compares modules created by `JSINativeModules` (host objects with lazy
+ * constants) with plain objects created from the full config, which is what
+ * `JSINativeModules` did before: for 150 modules with 10 methods and 50
+ * constants each, creating them plus the first accesses during startup (a
+ * method of every module, a constant of every tenth one) and the cost of a
+ * method lookup on a created module.
+ */
+
+static constexpr int kModuleCount = 150;
+static constexpr int kMethodCount = 10;
+static constexpr int kConstantCount = 50;
+
+static auto const requireModulesSource = std::string{R"JS(
+function requireModules(getModule, moduleCount) {
+  for (var i = 0; i < moduleCount; i++) {
+    var module = getModule('Module' + i);
+    module.method0();
+    if (i % 10 == 0) {
+      module.constant0;
+    }
+  }
+}
+
+function lookUpMethod(module, count) {
+  var method;
+  for (var i = 0; i < count; i++) {
+    method = module.method9;
+  }
+  return method;
+}
+)JS"};
+
+static std::string moduleName(int id) {
+  return folly::to<std::string>("Module", id);
+}
+
+static std::shared_ptr<ModuleRegistry> createRegistry() {
+  std::vector<std::string> methodNames;
+  for (int i = 0; i < kMethodCount; i++) {
+    methodNames.push_back(folly::to<std::string>("method", i));
+  }
+
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  for (int id = 0; id < kModuleCount; id++) {
+    auto constants = folly::dynamic::object();
+    for (int i = 0; i < kConstantCount; i++) {
+      constants(
+          folly::to<std::string>("constant", i),
+          folly::dynamic::object("id", i)(
+              "value", folly::to<std::string>("Module", id, ".", i)));
+    }
+    modules.push_back(std::make_unique<FakeNativeModule>(
+        moduleName(id), methodNames, std::move(constants)));
+  }
+  return std::make_shared<ModuleRegistry>(std::move(modules));
+}
+
+static std::unique_ptr<jsi::Runtime> createRuntime() {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  runtime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>(kGenNativeModuleSource),
+      "NativeModules.js");
+  runtime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>(requireModulesSource),
+      "benchmark.js");
+  return runtime;
+}
+
+/*
+ * Returns a function which creates the named module: through
+ * `JSINativeModules` or as a plain object from the full config.
+ */
+static jsi::Function createGetModule(
+    jsi::Runtime &runtime,
+    std::shared_ptr<ModuleRegistry> const &registry,
+    std::shared_ptr<JSINativeModules> const &nativeModules) {
+  return jsi::Function::createFromHostFunction(
+      runtime,
+      jsi::PropNameID::forAscii(runtime, "getModule"),
+      1,
+      [registry, nativeModules](
+          jsi::Runtime &runtime,
+          jsi::Value const &,
+          jsi::Value const *arguments,
+          size_t) -> jsi::Value {
+        auto name = arguments[0].asString(runtime).utf8(runtime);
+        if (nativeModules) {
+          return nativeModules->getModule(
+              runtime, jsi::PropNameID::forUtf8(runtime, name));
+        }
+
+        auto config = registry->getConfig(name);
+        return runtime.global()
+            .getPropertyAsFunction(runtime, "__fbGenNativeModule")
+            .call(
+                runtime,
+                jsi::valueFromDynamic(runtime, config->config),
+                static_cast<double>(config->index))
+            .asObject(runtime)
+            .getProperty(runtime, "module");
+      });
+}
+
+static void requireModules(benchmark::State &state, bool lazily) {
+  auto runtime = createRuntime();
+  auto requireModules =
+      runtime->global().getPropertyAsFunction(*runtime, "requireModules");
+
+  for (auto _ : state) {
+    auto registry = createRegistry();
+    auto nativeModules =
+        lazily ? std::make_shared<JSINativeModules>(registry) : nullptr;
+    requireModules.call(
+        *runtime,
+        createGetModule(*runtime, registry, nativeModules),
+        kModuleCount);
+
+    if (nativeModules) {
+      nativeModules->reset();
+    }
+  }
+}
+BENCHMARK_CAPTURE(requireModules, eagerly, false)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(requireModules, lazily, true)->Unit(benchmark::kMillisecond);
+
+static void lookUpMethod(benchmark::State &state, bool lazily) {
+  auto runtime = createRuntime();
+  auto registry = createRegistry();
+  auto nativeModules =
+      lazily ? std::make_shared<JSINativeModules>(registry) : nullptr;
+  auto module = createGetModule(*runtime, registry, nativeModules)
+                    .call(*runtime, moduleName(0));
+  auto lookUpMethod =
+      runtime->global().getPropertyAsFunction(*runtime, "lookUpMethod");
+
+  auto count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    lookUpMethod.call(*runtime, module, count);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+
+  if (nativeModules) {
+    module = jsi::Value::undefined();
+    nativeModules->reset();
+  }
+}
+BENCHMARK_CAPTURE(lookUpMethod, plainObject, false)->Arg(1000);
+BENCHMARK_CAPTURE(lookUpMethod, hostObject, true)->Arg(1000);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
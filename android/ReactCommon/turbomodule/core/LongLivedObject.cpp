@@ -10,6 +10,9 @@
 namespace facebook {
 namespace react {
 
+constexpr size_t LongLivedObject::kNoSlot;
+constexpr size_t LongLivedObjectCollection::kShardCount;
+
 // LongLivedObjectCollection
 LongLivedObjectCollection &LongLivedObjectCollection::get() {
   static LongLivedObjectCollection instance;
@@ -19,26 +22,86 @@ LongLivedObjectCollection &LongLivedObjectCollection::get() {
 LongLivedObjectCollection::LongLivedObjectCollection() {}
 
 void LongLivedObjectCollection::add(std::shared_ptr<LongLivedObject> so) const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  collection_.insert(so);
+  static std::atomic<size_t> nextShardIndex{0};
+  static thread_local size_t shardIndex = nextShardIndex++ % kShardCount;
+
+  auto &shard = shards_[shardIndex];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  auto slotIndex = shard.slots.size();
+  if (!shard.freeSlots.empty()) {
+    slotIndex = shard.freeSlots.back();
+  }
+
+  // Adding an object which is already in the collection is a no-op.
+  auto expected = LongLivedObject::kNoSlot;
+  if (!so->slot_.compare_exchange_strong(
+          expected,
+          slotIndex * kShardCount + shardIndex,
+          std::memory_order_acq_rel)) {
+    return;
+  }
+
+  if (slotIndex == shard.slots.size()) {
+    shard.slots.push_back(std::move(so));
+  } else {
+    shard.freeSlots.pop_back();
+    shard.slots[slotIndex] = std::move(so);
+  }
 }
 
 void LongLivedObjectCollection::remove(const LongLivedObject *o) const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  auto p = collection_.begin();
-  for (; p != collection_.end(); p++) {
-    if (p->get() == o) {
-      break;
-    }
+  auto slot = o->slot_.load(std::memory_order_acquire);
+  if (slot == LongLivedObject::kNoSlot) {
+    return;
   }
-  if (p != collection_.end()) {
-    collection_.erase(p);
+
+  auto &shard = shards_[slot % kShardCount];
+  auto slotIndex = slot / kShardCount;
+
+  // Destroyed after the lock is released.
+  auto object = std::shared_ptr<LongLivedObject>{};
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // The object might have been removed concurrently.
+    if (slotIndex >= shard.slots.size() ||
+        shard.slots[slotIndex].get() != o) {
+      return;
+    }
+
+    object = std::move(shard.slots[slotIndex]);
+    object->slot_.store(LongLivedObject::kNoSlot, std::memory_order_release);
+    shard.freeSlots.push_back(slotIndex);
   }
 }
 
 void LongLivedObjectCollection::clear() const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  collection_.clear();
+  for (auto &shard : shards_) {
+    // Destroyed after the lock is released.
+    auto slots = std::vector<std::shared_ptr<LongLivedObject>>{};
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      slots.swap(shard.slots);
+      shard.freeSlots.clear();
+
+      for (auto const &object : slots) {
+        if (object) {
+          object->slot_.store(
+              LongLivedObject::kNoSlot, std::memory_order_release);
+        }
+      }
+    }
+  }
+}
+
+size_t LongLivedObjectCollection::size() const {
+  auto size = size_t{0};
+  for (auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size += shard.slots.size() - shard.freeSlots.size();
+  }
+  return size;
 }
 
 // LongLivedObject
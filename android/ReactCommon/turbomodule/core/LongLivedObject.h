@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
-#include <unordered_set>
+#include <vector>
 
 namespace facebook {
 namespace react {
@@ -30,10 +32,26 @@ class LongLivedObject {
 
  protected:
   LongLivedObject();
+
+ private:
+  friend class LongLivedObjectCollection;
+
+  /**
+   * The position of the object in `LongLivedObjectCollection` (packed shard
+   * and slot indices), or `kNoSlot` if the object is not in the collection.
+   */
+  static constexpr size_t kNoSlot = ~size_t{0};
+  mutable std::atomic<size_t> slot_{kNoSlot};
 };
 
 /**
  * A singleton, thread-safe, write-only collection for the `LongLivedObject`s.
+ *
+ * The collection is split into shards (each thread adds objects to its own
+ * shard), so concurrent async calls from different threads rarely contend.
+ * Every object remembers its slot in the shard, so removal takes constant
+ * time; freed slots are reused. Objects are destroyed outside of locks, so
+ * their destructors can release other objects.
  */
 class LongLivedObjectCollection {
  public:
@@ -44,12 +62,29 @@ class LongLivedObjectCollection {
 
   void add(std::shared_ptr<LongLivedObject> o) const;
   void remove(const LongLivedObject *o) const;
+
+  /**
+   * Releases all objects at once (e.g. on runtime teardown).
+   */
   void clear() const;
 
+  /**
+   * Returns the number of objects in the collection.
+   */
+  size_t size() const;
+
  private:
   LongLivedObjectCollection();
-  mutable std::unordered_set<std::shared_ptr<LongLivedObject>> collection_;
-  mutable std::mutex collectionMutex_;
+
+  static constexpr size_t kShardCount = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<LongLivedObject>> slots;
+    std::vector<size_t> freeSlots;
+  };
+
+  mutable std::array<Shard, kShardCount> shards_;
 };
 
 } // namespace react
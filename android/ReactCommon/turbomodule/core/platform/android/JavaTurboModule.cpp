@@ -202,8 +202,117 @@ std::vector<std::string> getMethodArgTypesFromSignature(
   return methodArgs;
 }
 
+JavaTurboModuleArgType getArgKind(const std::string &type) {
+  if (type == "D") {
+    return JavaTurboModuleArgType::Double;
+  }
+  if (type == "Z") {
+    return JavaTurboModuleArgType::Boolean;
+  }
+  if (type == "Ljava/lang/Double;") {
+    return JavaTurboModuleArgType::BoxedDouble;
+  }
+  if (type == "Ljava/lang/Boolean;") {
+    return JavaTurboModuleArgType::BoxedBoolean;
+  }
+  if (type == "Ljava/lang/String;") {
+    return JavaTurboModuleArgType::String;
+  }
+  if (type == "Lcom/facebook/react/bridge/ReadableArray;") {
+    return JavaTurboModuleArgType::ReadableArray;
+  }
+  if (type == "Lcom/facebook/react/bridge/Callback;") {
+    return JavaTurboModuleArgType::Callback;
+  }
+  if (type == "Lcom/facebook/react/bridge/ReadableMap;") {
+    return JavaTurboModuleArgType::ReadableMap;
+  }
+  return JavaTurboModuleArgType::Unsupported;
+}
+
+/**
+ * Classes and methods used for boxing and unboxing of values and for creating
+ * promises. They are looked up once and shared by all modules.
+ */
+struct JavaTurboModuleClasses {
+  jclass doubleClass;
+  jmethodID doubleConstructor;
+  jmethodID doubleValueMethod;
+  jclass booleanClass;
+  jmethodID booleanConstructor;
+  jmethodID booleanValueMethod;
+  jclass promiseImplClass;
+  jmethodID promiseImplConstructor;
+};
+
+const JavaTurboModuleClasses &getJavaTurboModuleClasses(JNIEnv *env) {
+  static const JavaTurboModuleClasses classes = [env]() {
+    auto findClass = [env](const char *name) {
+      jclass localClass = env->FindClass(name);
+      auto globalClass = (jclass)env->NewGlobalRef(localClass);
+      env->DeleteLocalRef(localClass);
+      return globalClass;
+    };
+
+    JavaTurboModuleClasses classes;
+    classes.doubleClass = findClass("java/lang/Double");
+    classes.doubleConstructor =
+        env->GetMethodID(classes.doubleClass, "<init>", "(D)V");
+    classes.doubleValueMethod =
+        env->GetMethodID(classes.doubleClass, "doubleValue", "()D");
+    classes.booleanClass = findClass("java/lang/Boolean");
+    classes.booleanConstructor =
+        env->GetMethodID(classes.booleanClass, "<init>", "(Z)V");
+    classes.booleanValueMethod =
+        env->GetMethodID(classes.booleanClass, "booleanValue", "()Z");
+    classes.promiseImplClass =
+        findClass("com/facebook/react/bridge/PromiseImpl");
+    classes.promiseImplConstructor = env->GetMethodID(
+        classes.promiseImplClass,
+        "<init>",
+        "(Lcom/facebook/react/bridge/Callback;Lcom/facebook/react/bridge/Callback;)V");
+    return classes;
+  }();
+
+  return classes;
+}
+
 } // namespace
 
+const JavaTurboModuleMethod &JavaTurboModule::getMethod(
+    JNIEnv *env,
+    const std::string &methodName,
+    const std::string &methodSignature) {
+  auto iterator = methods_.find(methodName);
+  if (iterator != methods_.end()) {
+    return iterator->second;
+  }
+
+  jclass cls = env->GetObjectClass(instance_.get());
+  jmethodID methodID =
+      env->GetMethodID(cls, methodName.c_str(), methodSignature.c_str());
+  env->DeleteLocalRef(cls);
+
+  // If the method signature doesn't match, show a redbox here instead of
+  // crashing later.
+  FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
+
+  JavaTurboModuleMethod method;
+  method.methodID = methodID;
+  method.argTypes = getMethodArgTypesFromSignature(methodSignature);
+  method.argKinds.reserve(method.argTypes.size());
+  for (const auto &type : method.argTypes) {
+    method.argKinds.push_back(getArgKind(type));
+  }
+
+  std::string returnType =
+      methodSignature.substr(methodSignature.find_last_of(')') + 1);
+  method.isReturnTypeBoxed =
+      returnType == "Ljava/lang/Boolean;" || returnType == "Ljava/lang/Double;";
+
+  return methods_.emplace(methodName, std::move(method)).first->second;
+}
+
 // fnjni already does this conversion, but since we are using plain JNI, this
 // needs to be done again
 // TODO (axe) Reuse existing implementation as needed - the exist in
@@ -211,15 +320,15 @@ std::vector<std::string> getMethodArgTypesFromSignature(
 JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
     JNIEnv *env,
     jsi::Runtime &rt,
-    std::string methodName,
-    std::vector<std::string> methodArgTypes,
+    const std::string &methodName,
+    const JavaTurboModuleMethod &method,
     const jsi::Value *args,
     size_t count,
     std::shared_ptr<CallInvoker> jsInvoker,
     TurboModuleMethodValueKind valueKind) {
   unsigned int expectedArgumentCount = valueKind == PromiseKind
-      ? methodArgTypes.size() - 1
-      : methodArgTypes.size();
+      ? method.argTypes.size() - 1
+      : method.argTypes.size();
 
   if (expectedArgumentCount != count) {
     throw JavaTurboModuleInvalidArgumentCountException(
@@ -242,16 +351,13 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
     return obj;
   };
 
-  jclass booleanClass = nullptr;
-  jclass doubleClass = nullptr;
-
   for (unsigned int argIndex = 0; argIndex < count; argIndex += 1) {
-    std::string type = methodArgTypes.at(argIndex);
+    JavaTurboModuleArgType kind = method.argKinds[argIndex];
 
     const jsi::Value *arg = &args[argIndex];
     jvalue *jarg = &jargs[argIndex];
 
-    if (type == "D") {
+    if (kind == JavaTurboModuleArgType::Double) {
       if (!arg->isNumber()) {
         throw JavaTurboModuleArgumentConversionException(
             "number", argIndex, methodName, arg, &rt);
@@ -261,7 +367,7 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
       continue;
     }
 
-    if (type == "Z") {
+    if (kind == JavaTurboModuleArgType::Boolean) {
       if (!arg->isBool()) {
         throw JavaTurboModuleArgumentConversionException(
             "boolean", argIndex, methodName, arg, &rt);
@@ -271,13 +377,9 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
       continue;
     }
 
-    if (!(type == "Ljava/lang/Double;" || type == "Ljava/lang/Boolean;" ||
-          type == "Ljava/lang/String;" ||
-          type == "Lcom/facebook/react/bridge/ReadableArray;" ||
-          type == "Lcom/facebook/react/bridge/Callback;" ||
-          type == "Lcom/facebook/react/bridge/ReadableMap;")) {
+    if (kind == JavaTurboModuleArgType::Unsupported) {
       throw JavaTurboModuleInvalidArgumentTypeException(
-          type, argIndex, methodName);
+          method.argTypes[argIndex], argIndex, methodName);
     }
 
     if (arg->isNull() || arg->isUndefined()) {
@@ -285,88 +387,83 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
       continue;
     }
 
-    if (type == "Ljava/lang/Double;") {
-      if (!arg->isNumber()) {
-        throw JavaTurboModuleArgumentConversionException(
-            "number", argIndex, methodName, arg, &rt);
-      }
+    switch (kind) {
+      case JavaTurboModuleArgType::BoxedDouble: {
+        if (!arg->isNumber()) {
+          throw JavaTurboModuleArgumentConversionException(
+              "number", argIndex, methodName, arg, &rt);
+        }
 
-      if (doubleClass == nullptr) {
-        doubleClass = env->FindClass("java/lang/Double");
+        const auto &classes = getJavaTurboModuleClasses(env);
+        jarg->l = makeGlobalIfNecessary(env->NewObject(
+            classes.doubleClass, classes.doubleConstructor, arg->getNumber()));
+        break;
       }
 
-      jmethodID doubleConstructor =
-          env->GetMethodID(doubleClass, "<init>", "(D)V");
-      jarg->l = makeGlobalIfNecessary(
-          env->NewObject(doubleClass, doubleConstructor, arg->getNumber()));
-      continue;
-    }
-
-    if (type == "Ljava/lang/Boolean;") {
-      if (!arg->isBool()) {
-        throw JavaTurboModuleArgumentConversionException(
-            "boolean", argIndex, methodName, arg, &rt);
-      }
+      case JavaTurboModuleArgType::BoxedBoolean: {
+        if (!arg->isBool()) {
+          throw JavaTurboModuleArgumentConversionException(
+              "boolean", argIndex, methodName, arg, &rt);
+        }
 
-      if (booleanClass == nullptr) {
-        booleanClass = env->FindClass("java/lang/Boolean");
+        const auto &classes = getJavaTurboModuleClasses(env);
+        jarg->l = makeGlobalIfNecessary(env->NewObject(
+            classes.booleanClass, classes.booleanConstructor, arg->getBool()));
+        break;
       }
 
-      jmethodID booleanConstructor =
-          env->GetMethodID(booleanClass, "<init>", "(Z)V");
-      jarg->l = makeGlobalIfNecessary(
-          env->NewObject(booleanClass, booleanConstructor, arg->getBool()));
-      continue;
-    }
+      case JavaTurboModuleArgType::String: {
+        if (!arg->isString()) {
+          throw JavaTurboModuleArgumentConversionException(
+              "string", argIndex, methodName, arg, &rt);
+        }
 
-    if (type == "Ljava/lang/String;") {
-      if (!arg->isString()) {
-        throw JavaTurboModuleArgumentConversionException(
-            "string", argIndex, methodName, arg, &rt);
+        jarg->l = makeGlobalIfNecessary(
+            env->NewStringUTF(arg->getString(rt).utf8(rt).c_str()));
+        break;
       }
 
-      jarg->l = makeGlobalIfNecessary(
-          env->NewStringUTF(arg->getString(rt).utf8(rt).c_str()));
-      continue;
-    }
+      case JavaTurboModuleArgType::ReadableArray: {
+        if (!(arg->isObject() && arg->getObject(rt).isArray(rt))) {
+          throw JavaTurboModuleArgumentConversionException(
+              "Array", argIndex, methodName, arg, &rt);
+        }
 
-    if (type == "Lcom/facebook/react/bridge/ReadableArray;") {
-      if (!(arg->isObject() && arg->getObject(rt).isArray(rt))) {
-        throw JavaTurboModuleArgumentConversionException(
-            "Array", argIndex, methodName, arg, &rt);
+        auto dynamicFromValue = jsi::dynamicFromValue(rt, *arg);
+        auto jParams =
+            ReadableNativeArray::newObjectCxxArgs(std::move(dynamicFromValue));
+        jarg->l = makeGlobalIfNecessary(jParams.release());
+        break;
       }
 
-      auto dynamicFromValue = jsi::dynamicFromValue(rt, *arg);
-      auto jParams =
-          ReadableNativeArray::newObjectCxxArgs(std::move(dynamicFromValue));
-      jarg->l = makeGlobalIfNecessary(jParams.release());
-      continue;
-    }
+      case JavaTurboModuleArgType::Callback: {
+        if (!(arg->isObject() && arg->getObject(rt).isFunction(rt))) {
+          throw JavaTurboModuleArgumentConversionException(
+              "Function", argIndex, methodName, arg, &rt);
+        }
 
-    if (type == "Lcom/facebook/react/bridge/Callback;") {
-      if (!(arg->isObject() && arg->getObject(rt).isFunction(rt))) {
-        throw JavaTurboModuleArgumentConversionException(
-            "Function", argIndex, methodName, arg, &rt);
+        jsi::Function fn = arg->getObject(rt).getFunction(rt);
+        jarg->l = makeGlobalIfNecessary(
+            createJavaCallbackFromJSIFunction(std::move(fn), rt, jsInvoker)
+                .release());
+        break;
       }
 
-      jsi::Function fn = arg->getObject(rt).getFunction(rt);
-      jarg->l = makeGlobalIfNecessary(
-          createJavaCallbackFromJSIFunction(std::move(fn), rt, jsInvoker)
-              .release());
-      continue;
-    }
+      case JavaTurboModuleArgType::ReadableMap: {
+        if (!(arg->isObject())) {
+          throw JavaTurboModuleArgumentConversionException(
+              "Object", argIndex, methodName, arg, &rt);
+        }
 
-    if (type == "Lcom/facebook/react/bridge/ReadableMap;") {
-      if (!(arg->isObject())) {
-        throw JavaTurboModuleArgumentConversionException(
-            "Object", argIndex, methodName, arg, &rt);
+        auto dynamicFromValue = jsi::dynamicFromValue(rt, *arg);
+        auto jParams =
+            ReadableNativeMap::createWithContents(std::move(dynamicFromValue));
+        jarg->l = makeGlobalIfNecessary(jParams.release());
+        break;
       }
 
-      auto dynamicFromValue = jsi::dynamicFromValue(rt, *arg);
-      auto jParams =
-          ReadableNativeMap::createWithContents(std::move(dynamicFromValue));
-      jarg->l = makeGlobalIfNecessary(jParams.release());
-      continue;
+      default:
+        break;
     }
   }
 
@@ -432,13 +529,9 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
    */
   jni::JniLocalScope scope(env, estimatedLocalRefCount);
 
-  jclass cls = env->GetObjectClass(instance);
-  jmethodID methodID =
-      env->GetMethodID(cls, methodName.c_str(), methodSignature.c_str());
-
-  // If the method signature doesn't match, show a redbox here instead of
-  // crashing later.
-  FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
+  const JavaTurboModuleMethod &method =
+      getMethod(env, methodName, methodSignature);
+  jmethodID methodID = method.methodID;
 
   // TODO(T43933641): Refactor to remove this special-casing
   if (methodName == "getConstants") {
@@ -452,14 +545,11 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
     return convertFromJMapToValue(env, runtime, constantsMap);
   }
 
-  std::vector<std::string> methodArgTypes =
-      getMethodArgTypesFromSignature(methodSignature);
-
   JNIArgs jniArgs = convertJSIArgsToJNIArgs(
       env,
       runtime,
       methodName,
-      methodArgTypes,
+      method,
       args,
       argCount,
       jsInvoker_,
@@ -491,9 +581,7 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
       return jsi::Value::undefined();
     }
     case BooleanKind: {
-      std::string returnType =
-          methodSignature.substr(methodSignature.find_last_of(')') + 1);
-      if (returnType == "Ljava/lang/Boolean;") {
+      if (method.isReturnTypeBoxed) {
         auto returnObject =
             (jobject)env->CallObjectMethodA(instance, methodID, jargs.data());
         FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
@@ -502,11 +590,9 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
           return jsi::Value::null();
         }
 
-        jclass booleanClass = env->FindClass("java/lang/Boolean");
-        jmethodID booleanValueMethod =
-            env->GetMethodID(booleanClass, "booleanValue", "()Z");
-        bool returnBoolean =
-            (bool)env->CallBooleanMethod(returnObject, booleanValueMethod);
+        bool returnBoolean = (bool)env->CallBooleanMethod(
+            returnObject,
+            getJavaTurboModuleClasses(env).booleanValueMethod);
         FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
 
         return jsi::Value(returnBoolean);
@@ -519,9 +605,7 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
       return jsi::Value(returnBoolean);
     }
     case NumberKind: {
-      std::string returnType =
-          methodSignature.substr(methodSignature.find_last_of(')') + 1);
-      if (returnType == "Ljava/lang/Double;") {
+      if (method.isReturnTypeBoxed) {
         auto returnObject =
             (jobject)env->CallObjectMethodA(instance, methodID, jargs.data());
         FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
@@ -530,11 +614,8 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
           return jsi::Value::null();
         }
 
-        jclass doubleClass = env->FindClass("java/lang/Double");
-        jmethodID doubleValueMethod =
-            env->GetMethodID(doubleClass, "doubleValue", "()D");
-        double returnDouble =
-            (double)env->CallDoubleMethod(returnObject, doubleValueMethod);
+        double returnDouble = (double)env->CallDoubleMethod(
+            returnObject, getJavaTurboModuleClasses(env).doubleValueMethod);
         FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
 
         return jsi::Value(returnDouble);
@@ -614,15 +695,12 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
                               std::move(rejectJSIFn), runtime, jsInvoker_)
                               .release();
 
-            jclass jPromiseImpl =
-                env->FindClass("com/facebook/react/bridge/PromiseImpl");
-            jmethodID jPromiseImplConstructor = env->GetMethodID(
-                jPromiseImpl,
-                "<init>",
-                "(Lcom/facebook/react/bridge/Callback;Lcom/facebook/react/bridge/Callback;)V");
-
+            const auto &classes = getJavaTurboModuleClasses(env);
             jobject promise = env->NewObject(
-                jPromiseImpl, jPromiseImplConstructor, resolve, reject);
+                classes.promiseImplClass,
+                classes.promiseImplConstructor,
+                resolve,
+                reject);
 
             jargs[argCount].l = promise;
             env->CallVoidMethodA(instance, methodID, jargs.data());
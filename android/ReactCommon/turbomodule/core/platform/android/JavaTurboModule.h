@@ -8,7 +8,9 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <ReactCommon/TurboModule.h>
 #include <ReactCommon/TurboModuleUtils.h>
@@ -25,6 +27,33 @@ struct JNIArgs {
   std::vector<jobject> globalRefs_;
 };
 
+/*
+ * The type of an argument of a Java method, as `invokeJavaMethod` sees it.
+ */
+enum class JavaTurboModuleArgType {
+  Double,
+  Boolean,
+  BoxedDouble,
+  BoxedBoolean,
+  String,
+  ReadableArray,
+  Callback,
+  ReadableMap,
+  Unsupported,
+};
+
+/*
+ * Everything `invokeJavaMethod` needs to know about a method that can be
+ * derived from its name and JNI signature. Computed on the first call of the
+ * method and reused by all following calls.
+ */
+struct JavaTurboModuleMethod {
+  jmethodID methodID;
+  std::vector<std::string> argTypes;
+  std::vector<JavaTurboModuleArgType> argKinds;
+  bool isReturnTypeBoxed;
+};
+
 struct JTurboModule : jni::JavaClass<JTurboModule> {
   static auto constexpr kJavaDescriptor =
       "Lcom/facebook/react/turbomodule/core/interfaces/TurboModule;";
@@ -49,11 +78,22 @@ class JSI_EXPORT JavaTurboModule : public TurboModule {
   jni::global_ref<JTurboModule> instance_;
   std::shared_ptr<CallInvoker> nativeInvoker_;
 
+  /*
+   * Methods are only called from the JavaScript thread, so the map does not
+   * need a lock.
+   */
+  std::unordered_map<std::string, JavaTurboModuleMethod> methods_;
+
+  const JavaTurboModuleMethod &getMethod(
+      JNIEnv *env,
+      const std::string &methodName,
+      const std::string &methodSignature);
+
   JNIArgs convertJSIArgsToJNIArgs(
       JNIEnv *env,
       jsi::Runtime &rt,
-      std::string methodName,
-      std::vector<std::string> methodArgTypes,
+      const std::string &methodName,
+      const JavaTurboModuleMethod &method,
       const jsi::Value *args,
       size_t count,
       std::shared_ptr<CallInvoker> jsInvoker,
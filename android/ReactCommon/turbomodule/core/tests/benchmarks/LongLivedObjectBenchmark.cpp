@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <ReactCommon/LongLivedObject.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Measures adding objects to `LongLivedObjectCollection` and releasing them
+ * (what every async TurboModule call does) from several threads at once,
+ * with a given number of objects held by every thread at any time.
+ */
+
+class BenchmarkObject : public LongLivedObject {};
+
+static void addAndRelease(benchmark::State &state) {
+  auto &collection = LongLivedObjectCollection::get();
+  auto objects = std::vector<std::shared_ptr<BenchmarkObject>>{};
+  for (auto i = 0; i < state.range(0); i++) {
+    objects.push_back(std::make_shared<BenchmarkObject>());
+    collection.add(objects.back());
+  }
+
+  auto index = size_t{0};
+  for (auto _ : state) {
+    auto &object = objects[index];
+    object->allowRelease();
+    collection.add(object);
+    index = (index + 1) % objects.size();
+  }
+
+  for (auto const &object : objects) {
+    object->allowRelease();
+  }
+}
+BENCHMARK(addAndRelease)
+    ->Arg(1)
+    ->Arg(1000)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Takes a function and calls it asynchronously on some background thread
+ * (e.g. on a serial queue with a low priority). The function must not assume
+ * anything about the particular thread.
+ */
+using BackgroundExecutor =
+    std::function<void(std::function<void()> &&callback)>;
+
+} // namespace react
+} // namespace facebook
@@ -9,6 +9,7 @@ public class EXGL {
   }
   public static native int EXGLContextCreate(long jsCtxPtr);
 
+  public static native void EXGLContextPrepareForDestroy(int exglCtxId);
   public static native void EXGLContextDestroy(int exglCtxId);
   public static native void EXGLContextFlush(int exglCtxId);
 
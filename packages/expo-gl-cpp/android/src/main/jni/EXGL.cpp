@@ -15,6 +15,12 @@ Java_expo_modules_gl_cpp_EXGL_EXGLContextCreate
   return UEXGLContextCreate((void*) jsiPtr);
 }
 
+JNIEXPORT void JNICALL
+Java_expo_modules_gl_cpp_EXGL_EXGLContextPrepareForDestroy
+(JNIEnv *env, jclass clazz, jint exglCtxId) {
+  UEXGLContextPrepareForDestroy(exglCtxId);
+}
+
 JNIEXPORT void JNICALL
 Java_expo_modules_gl_cpp_EXGL_EXGLContextDestroy
 (JNIEnv *env, jclass clazz, jint exglCtxId) {
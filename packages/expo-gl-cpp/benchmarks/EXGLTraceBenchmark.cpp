@@ -0,0 +1,317 @@
+// Headless harness that replays WebGL call traces through EXGL native methods.
+//
+// GL runs on an EGL surfaceless context (Mesa llvmpipe works fine) and JS runs on Hermes. Both
+// live on the main thread, so flushOnGLThread executes batches synchronously, which makes flush
+// latency easy to attribute. Rendering goes to an offscreen renderbuffer set as the default
+// framebuffer of the EXGL context, so traces recorded on devices can be replayed unchanged.
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES3/gl3.h>
+
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "UEXGL.h"
+
+namespace jsi = facebook::jsi;
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+  std::string tracePath;
+  std::string replayScriptPath = EXGL_REPLAY_SCRIPT;
+  int syntheticMeshes = 0;
+  int syntheticFrames = 300;
+  int repeat = 1;
+  int width = 1024;
+  int height = 768;
+  bool finish = false;
+  bool json = false;
+};
+
+struct Stats {
+  std::vector<double> batchSizes;
+  std::vector<double> flushMicros;
+  double calls = 0;
+  double frameMicros = 0;
+  double finishMicros = 0;
+  int frames = 0;
+};
+
+void usage(const char *name) {
+  fprintf(
+      stderr,
+      "Usage: %s (--trace <file.json> | --synthetic <meshes>) [options]\n"
+      "  --frames <n>       number of frames generated by --synthetic (default 300)\n"
+      "  --repeat <n>       replay the trace n times (default 1)\n"
+      "  --size <w>x<h>     size of the offscreen framebuffer (default 1024x768)\n"
+      "  --finish           call glFinish after every frame and report GPU wait separately\n"
+      "  --replay-script    path to replay.js\n"
+      "  --json             print results as JSON\n",
+      name);
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--trace" && hasValue) {
+      options.tracePath = argv[++i];
+    } else if (arg == "--synthetic" && hasValue) {
+      options.syntheticMeshes = std::atoi(argv[++i]);
+    } else if (arg == "--frames" && hasValue) {
+      options.syntheticFrames = std::atoi(argv[++i]);
+    } else if (arg == "--repeat" && hasValue) {
+      options.repeat = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--size" && hasValue) {
+      if (sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2) {
+        return false;
+      }
+    } else if (arg == "--replay-script" && hasValue) {
+      options.replayScriptPath = argv[++i];
+    } else if (arg == "--finish") {
+      options.finish = true;
+    } else if (arg == "--json") {
+      options.json = true;
+    } else {
+      return false;
+    }
+  }
+  return !options.tracePath.empty() || options.syntheticMeshes > 0;
+}
+
+std::string readFile(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    throw std::runtime_error("Can't read " + path);
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return buffer.str();
+}
+
+// Surfaceless context if available, otherwise whatever the default display supports
+void makeCurrentHeadlessContext() {
+  EGLDisplay display = EGL_NO_DISPLAY;
+  auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+      eglGetProcAddress("eglGetPlatformDisplayEXT"));
+  if (getPlatformDisplay) {
+    display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+  }
+  if (display == EGL_NO_DISPLAY) {
+    display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+  if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+    throw std::runtime_error("Failed to initialize EGL display");
+  }
+  eglBindAPI(EGL_OPENGL_ES_API);
+
+  const EGLint configAttribs[] = {EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_NONE};
+  EGLConfig config;
+  EGLint numConfigs = 0;
+  if (!eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs == 0) {
+    throw std::runtime_error("No EGL config supporting OpenGL ES 3");
+  }
+
+  const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
+  EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+  if (context == EGL_NO_CONTEXT ||
+      !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+    throw std::runtime_error("Failed to make OpenGL ES 3 context current");
+  }
+}
+
+GLuint createOffscreenFramebuffer(int width, int height) {
+  GLuint framebuffer, colorRenderbuffer, depthRenderbuffer;
+  glGenFramebuffers(1, &framebuffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+  glGenRenderbuffers(1, &colorRenderbuffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, colorRenderbuffer);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+  glFramebufferRenderbuffer(
+      GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRenderbuffer);
+
+  glGenRenderbuffers(1, &depthRenderbuffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, depthRenderbuffer);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+  glFramebufferRenderbuffer(
+      GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthRenderbuffer);
+
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+    throw std::runtime_error("Offscreen framebuffer is incomplete");
+  }
+  return framebuffer;
+}
+
+double percentile(std::vector<double> values, double p) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  size_t index = std::min(values.size() - 1, static_cast<size_t>(p * values.size()));
+  return values[index];
+}
+
+double mean(const std::vector<double> &values) {
+  return values.empty() ? 0 : std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+}
+
+void printStats(const Stats &stats, bool json) {
+  double flushTotal = std::accumulate(stats.flushMicros.begin(), stats.flushMicros.end(), 0.0);
+  double callsPerSec = stats.calls / (stats.frameMicros / 1e6);
+  double enqueueCallsPerSec = stats.calls / ((stats.frameMicros - flushTotal) / 1e6);
+
+  if (json) {
+    printf(
+        "{\"frames\":%d,\"calls\":%.0f,\"callsPerSec\":%.0f,\"enqueueCallsPerSec\":%.0f,"
+        "\"frameMicros\":{\"mean\":%.1f},\"finishMicros\":{\"mean\":%.1f},"
+        "\"batches\":%zu,\"batchSize\":{\"mean\":%.1f,\"p50\":%.0f,\"p95\":%.0f,\"max\":%.0f},"
+        "\"flushMicros\":{\"mean\":%.1f,\"p50\":%.1f,\"p95\":%.1f,\"max\":%.1f}}\n",
+        stats.frames,
+        stats.calls,
+        callsPerSec,
+        enqueueCallsPerSec,
+        stats.frameMicros / stats.frames,
+        stats.finishMicros / stats.frames,
+        stats.batchSizes.size(),
+        mean(stats.batchSizes),
+        percentile(stats.batchSizes, 0.5),
+        percentile(stats.batchSizes, 0.95),
+        percentile(stats.batchSizes, 1),
+        mean(stats.flushMicros),
+        percentile(stats.flushMicros, 0.5),
+        percentile(stats.flushMicros, 0.95),
+        percentile(stats.flushMicros, 1));
+    return;
+  }
+  printf("frames:               %d\n", stats.frames);
+  printf("calls:                %.0f\n", stats.calls);
+  printf("calls/sec:            %.0f (including flushes)\n", callsPerSec);
+  printf("calls/sec:            %.0f (JS and enqueueing only)\n", enqueueCallsPerSec);
+  printf("frame time:           %.1f us mean\n", stats.frameMicros / stats.frames);
+  if (stats.finishMicros > 0) {
+    printf("glFinish wait:        %.1f us mean\n", stats.finishMicros / stats.frames);
+  }
+  printf("batches:              %zu\n", stats.batchSizes.size());
+  printf(
+      "batch size:           mean %.1f, p50 %.0f, p95 %.0f, max %.0f\n",
+      mean(stats.batchSizes),
+      percentile(stats.batchSizes, 0.5),
+      percentile(stats.batchSizes, 0.95),
+      percentile(stats.batchSizes, 1));
+  printf(
+      "flush latency:        mean %.1f us, p50 %.1f us, p95 %.1f us, max %.1f us\n",
+      mean(stats.flushMicros),
+      percentile(stats.flushMicros, 0.5),
+      percentile(stats.flushMicros, 0.95),
+      percentile(stats.flushMicros, 1));
+}
+
+int run(const Options &options) {
+  makeCurrentHeadlessContext();
+  GLuint framebuffer = createOffscreenFramebuffer(options.width, options.height);
+
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  runtime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>(readFile(options.replayScriptPath)), "replay.js");
+  auto bench = runtime->global().getPropertyAsObject(*runtime, "__EXGLBench");
+
+  UEXGLContextId exglCtxId = UEXGLContextCreate(runtime.get());
+  UEXGLContextSetDefaultFramebuffer(exglCtxId, framebuffer);
+
+  Stats stats;
+  double callsAtLastFlush = 0;
+  UEXGLContextSetFlushMethod(exglCtxId, [&] {
+    auto start = Clock::now();
+    UEXGLContextFlush(exglCtxId);
+    auto end = Clock::now();
+    stats.flushMicros.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+    double calls = bench.getProperty(*runtime, "calls").asNumber();
+    stats.batchSizes.push_back(calls - callsAtLastFlush);
+    callsAtLastFlush = calls;
+  });
+
+  if (options.tracePath.empty()) {
+    bench.getPropertyAsFunction(*runtime, "synthetic")
+        .call(
+            *runtime,
+            static_cast<double>(exglCtxId),
+            options.syntheticMeshes,
+            options.syntheticFrames);
+  } else {
+    bench.getPropertyAsFunction(*runtime, "load")
+        .call(
+            *runtime,
+            jsi::String::createFromUtf8(*runtime, readFile(options.tracePath)),
+            static_cast<double>(exglCtxId));
+  }
+
+  int frameCount = static_cast<int>(bench.getProperty(*runtime, "frameCount").asNumber());
+  auto runFrame = bench.getPropertyAsFunction(*runtime, "runFrame");
+
+  // The first frame of a trace usually sets up shaders and buffers, it's replayed once and
+  // kept out of the results
+  runFrame.call(*runtime, 0);
+  glFinish();
+  stats = Stats();
+  callsAtLastFlush = bench.getProperty(*runtime, "calls").asNumber();
+
+  for (int iteration = 0; iteration < options.repeat; iteration++) {
+    for (int frame = 1; frame < frameCount; frame++) {
+      auto start = Clock::now();
+      stats.calls += runFrame.call(*runtime, frame).asNumber();
+      auto end = Clock::now();
+      stats.frameMicros += std::chrono::duration<double, std::micro>(end - start).count();
+      stats.frames++;
+
+      if (options.finish) {
+        glFinish();
+        stats.finishMicros +=
+            std::chrono::duration<double, std::micro>(Clock::now() - end).count();
+      }
+    }
+  }
+
+  if (stats.frames == 0) {
+    fprintf(stderr, "Trace has no frames besides the setup frame\n");
+    return 1;
+  }
+  printStats(stats, options.json);
+  UEXGLContextPrepareForDestroy(exglCtxId);
+  UEXGLContextDestroy(exglCtxId);
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    usage(argv[0]);
+    return 2;
+  }
+  try {
+    return run(options);
+  } catch (const jsi::JSError &error) {
+    fprintf(stderr, "JS error: %s\n%s\n", error.getMessage().c_str(), error.getStack().c_str());
+  } catch (const std::exception &error) {
+    fprintf(stderr, "Error: %s\n", error.what());
+  }
+  return 1;
+}
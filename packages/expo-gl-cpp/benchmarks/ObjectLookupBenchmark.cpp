@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include "EXGLObjectMap.h"
+
+// Compares the object mapping used by EXGLContext::mapObject/lookupObject with the hash map it
+// replaced. The draw loop resembles what three.js issues per mesh: bind program, bind VAO, bind
+// buffer, bind texture, draw.
+
+using namespace expo::gl_cpp;
+
+namespace {
+
+class HashMapObjects {
+ public:
+  UEXGLObjectId create() {
+    return nextObjectId++;
+  }
+
+  void map(UEXGLObjectId exglObjId, GLuint glObj, EXGLObjectKind) {
+    objects[exglObjId] = glObj;
+  }
+
+  GLuint lookup(UEXGLObjectId exglObjId) {
+    auto iter = objects.find(exglObjId);
+    return iter == objects.end() ? 0 : iter->second;
+  }
+
+ private:
+  std::unordered_map<UEXGLObjectId, GLuint> objects;
+  UEXGLObjectId nextObjectId = 1;
+};
+
+constexpr int kObjectsPerMesh = 4; // program, vertex array, buffer, texture
+
+template <typename Objects>
+void drawLoop(benchmark::State &state, Objects &objects) {
+  auto meshCount = static_cast<size_t>(state.range(0));
+  std::vector<UEXGLObjectId> ids(meshCount * kObjectsPerMesh);
+  for (size_t i = 0; i < ids.size(); i++) {
+    ids[i] = objects.create();
+    objects.map(ids[i], static_cast<GLuint>(i * 3 + 1), EXGLObjectKind::Buffer);
+  }
+
+  for (auto _ : state) {
+    GLuint sum = 0;
+    for (auto id : ids) {
+      sum += objects.lookup(id);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * ids.size());
+}
+
+void hashMapDrawLoop(benchmark::State &state) {
+  HashMapObjects objects;
+  drawLoop(state, objects);
+}
+
+void objectMapDrawLoop(benchmark::State &state) {
+  EXGLObjectIdAllocator allocator;
+  EXGLObjectMap objects(allocator);
+  drawLoop(state, objects);
+}
+
+} // namespace
+
+BENCHMARK(hashMapDrawLoop)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(objectMapDrawLoop)->Arg(100)->Arg(1000)->Arg(10000);
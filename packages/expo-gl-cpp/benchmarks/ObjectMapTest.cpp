@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include "EXGLObjectMap.h"
+
+using namespace expo::gl_cpp;
+
+static constexpr auto kBuffer = EXGLObjectKind::Buffer;
+
+TEST(EXGLObjectMapTest, MapsAndUnmapsObjects) {
+  EXGLObjectIdAllocator allocator;
+  EXGLObjectMap objects(allocator);
+
+  auto buffer = objects.create();
+  auto texture = objects.create();
+  EXPECT_NE(buffer, 0u);
+  EXPECT_NE(texture, buffer);
+
+  objects.map(buffer, 7, kBuffer);
+  objects.map(texture, 3, EXGLObjectKind::Texture);
+  EXPECT_EQ(objects.lookup(buffer), 7u);
+  EXPECT_EQ(objects.lookup(texture), 3u);
+  EXPECT_EQ(objects.find(7, kBuffer), buffer);
+  EXPECT_EQ(objects.find(3, EXGLObjectKind::Texture), texture);
+
+  objects.unmap(buffer);
+  EXPECT_EQ(objects.lookup(buffer), 0u);
+  EXPECT_EQ(objects.find(7, kBuffer), 0u);
+  EXPECT_EQ(objects.lookup(texture), 3u);
+}
+
+TEST(EXGLObjectMapTest, ReusesReleasedIndicesWithNewGeneration) {
+  EXGLObjectIdAllocator allocator;
+  EXGLObjectMap objects(allocator);
+
+  auto stale = objects.create();
+  objects.map(stale, 5, kBuffer);
+  objects.unmap(stale);
+  objects.release(stale);
+
+  auto reused = objects.create();
+  EXPECT_NE(reused, stale);
+  EXPECT_EQ(EXGLObjectIdAllocator::indexOf(reused), EXGLObjectIdAllocator::indexOf(stale));
+
+  objects.map(reused, 9, kBuffer);
+  EXPECT_EQ(objects.lookup(reused), 9u);
+  EXPECT_EQ(objects.lookup(stale), 0u);
+  EXPECT_EQ(objects.find(9, kBuffer), reused);
+
+  // a stale id must not unmap or release the object that took over its index
+  objects.unmap(stale);
+  objects.release(stale);
+  EXPECT_EQ(objects.lookup(reused), 9u);
+  EXPECT_NE(objects.create(), reused);
+}
+
+TEST(EXGLObjectMapTest, IgnoresDoubleRelease) {
+  EXGLObjectIdAllocator allocator;
+
+  auto id = allocator.allocate();
+  allocator.release(id);
+  allocator.release(id);
+
+  auto first = allocator.allocate();
+  auto second = allocator.allocate();
+  EXPECT_NE(first, second);
+  EXPECT_NE(EXGLObjectIdAllocator::indexOf(first), EXGLObjectIdAllocator::indexOf(second));
+}
+
+TEST(EXGLObjectMapTest, ReusesFreedIndicesInOrder) {
+  EXGLObjectIdAllocator allocator;
+
+  auto first = allocator.allocate();
+  auto second = allocator.allocate();
+  allocator.release(first);
+  allocator.release(second);
+
+  EXPECT_EQ(
+      EXGLObjectIdAllocator::indexOf(allocator.allocate()), EXGLObjectIdAllocator::indexOf(first));
+  EXPECT_EQ(
+      EXGLObjectIdAllocator::indexOf(allocator.allocate()), EXGLObjectIdAllocator::indexOf(second));
+}
+
+TEST(EXGLObjectMapTest, KeepsIdsOfContextsApart) {
+  EXGLObjectIdAllocator allocator;
+  EXGLObjectMap firstContext(allocator);
+  EXGLObjectMap secondContext(allocator);
+
+  auto firstId = firstContext.create();
+  auto secondId = secondContext.create();
+  EXPECT_NE(firstId, secondId);
+
+  firstContext.map(firstId, 1, kBuffer);
+  secondContext.map(secondId, 1, kBuffer);
+  EXPECT_EQ(firstContext.lookup(secondId), 0u);
+  EXPECT_EQ(secondContext.lookup(firstId), 0u);
+}
+
+TEST(EXGLObjectMapTest, ReleasesMappedIdsOnDestruction) {
+  EXGLObjectIdAllocator allocator;
+  UEXGLObjectId id;
+  {
+    EXGLObjectMap objects(allocator);
+    id = objects.create();
+    objects.map(id, 4, kBuffer);
+  }
+
+  auto reused = allocator.allocate();
+  EXPECT_EQ(EXGLObjectIdAllocator::indexOf(reused), EXGLObjectIdAllocator::indexOf(id));
+  EXPECT_NE(reused, id);
+}
+
+TEST(EXGLObjectMapTest, IgnoresNullAndUnknownIds) {
+  EXGLObjectIdAllocator allocator;
+  EXGLObjectMap objects(allocator);
+
+  objects.map(0, 1, kBuffer);
+  EXPECT_EQ(objects.lookup(0), 0u);
+  EXPECT_EQ(objects.lookup(12345), 0u);
+  EXPECT_EQ(objects.find(0, kBuffer), 0u);
+  objects.unmap(12345);
+  objects.release(12345);
+  EXPECT_EQ(allocator.allocate(), 1u);
+}
+
+TEST(EXGLObjectMapTest, KeepsNamesOfObjectKindsApart) {
+  EXGLObjectIdAllocator allocator;
+  EXGLObjectMap objects(allocator);
+
+  // drivers number buffers and textures separately, both usually start at 1
+  auto buffer = objects.create();
+  auto texture = objects.create();
+  objects.map(buffer, 1, EXGLObjectKind::Buffer);
+  objects.map(texture, 1, EXGLObjectKind::Texture);
+  EXPECT_EQ(objects.find(1, EXGLObjectKind::Buffer), buffer);
+  EXPECT_EQ(objects.find(1, EXGLObjectKind::Texture), texture);
+  EXPECT_EQ(objects.find(1, EXGLObjectKind::Program), 0u);
+
+  objects.unmap(buffer);
+  EXPECT_EQ(objects.find(1, EXGLObjectKind::Buffer), 0u);
+  EXPECT_EQ(objects.find(1, EXGLObjectKind::Texture), texture);
+  EXPECT_EQ(objects.lookup(texture), 1u);
+}
+
+TEST(EXGLObjectMapTest, TakesSyncObjectsJSDidNotDelete) {
+  EXGLObjectIdAllocator allocator;
+  EXGLObjectMap objects(allocator);
+
+  auto deleted = objects.create();
+  auto leaked = objects.create();
+  auto deletedSync = reinterpret_cast<GLsync>(uintptr_t{0x10});
+  auto leakedSync = reinterpret_cast<GLsync>(uintptr_t{0x20});
+  objects.mapSync(deleted, deletedSync);
+  objects.mapSync(leaked, leakedSync);
+  EXPECT_EQ(objects.lookupSync(leaked), leakedSync);
+
+  objects.unmapSync(deleted);
+  objects.release(deleted);
+  EXPECT_EQ(objects.lookupSync(deleted), nullptr);
+
+  auto syncs = objects.takeSyncs();
+  ASSERT_EQ(syncs.size(), 1u);
+  EXPECT_EQ(syncs[0], leakedSync);
+  EXPECT_EQ(objects.lookupSync(leaked), nullptr);
+  EXPECT_TRUE(objects.takeSyncs().empty());
+
+  // both indices are free again, in the order they were released
+  EXPECT_EQ(
+      EXGLObjectIdAllocator::indexOf(allocator.allocate()), EXGLObjectIdAllocator::indexOf(deleted));
+  EXPECT_EQ(
+      EXGLObjectIdAllocator::indexOf(allocator.allocate()), EXGLObjectIdAllocator::indexOf(leaked));
+}
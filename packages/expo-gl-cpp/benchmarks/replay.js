@@ -0,0 +1,163 @@
+// Replays WebGL call traces against a native EXGL context, used by exgl-trace-benchmark.
+//
+// Trace format (JSON):
+//   { "frames": [ [ ["methodName", [arg, ...], result], ... ], ... ] }
+//
+// Calls go straight to the native methods, so arguments use the same representation as
+// the native side expects after the JS wrappers from expo-gl unwrap them. Arguments are plain
+// JSON values, except for objects of the following shapes:
+//   { "object": id }              - EXGL object id as it was recorded, remapped to the id
+//                                   returned by the matching create* call during replay
+//   { "Float32Array": [...] }     - typed array of any kind with the given contents
+//   { "ArrayBuffer": byteLength } - zero filled ArrayBuffer
+// Result is optional and only needed for calls whose return value is passed to later calls
+// (create*, fenceSync, getUniformLocation).
+// Each frame is followed by endFrameEXP, there is no need to record it.
+(function(global) {
+  var TYPED_ARRAYS = {
+    Int8Array: Int8Array,
+    Int16Array: Int16Array,
+    Int32Array: Int32Array,
+    Uint8Array: Uint8Array,
+    Uint8ClampedArray: Uint8ClampedArray,
+    Uint16Array: Uint16Array,
+    Uint32Array: Uint32Array,
+    Float32Array: Float32Array,
+    Float64Array: Float64Array,
+  };
+
+  var gl = null;
+  var frames = [];
+  var objectIds = {};
+
+  // Decode everything upfront so that replay loop measures native calls only
+  function decodeCall(call) {
+    var method = gl[call[0]];
+    if (typeof method !== 'function') {
+      throw new Error('Unknown method in trace: ' + call[0]);
+    }
+    var args = call[1] || [];
+    var objectArgs = [];
+    var decodedArgs = args.map(function(arg, index) {
+      if (arg === null || typeof arg !== 'object' || Array.isArray(arg)) {
+        return arg;
+      }
+      if ('object' in arg) {
+        objectArgs.push(index, arg.object);
+        return 0;
+      }
+      if ('ArrayBuffer' in arg) {
+        return new ArrayBuffer(arg.ArrayBuffer);
+      }
+      for (var name in TYPED_ARRAYS) {
+        if (name in arg) {
+          return new TYPED_ARRAYS[name](arg[name]);
+        }
+      }
+      throw new Error('Unsupported argument in trace: ' + JSON.stringify(arg));
+    });
+    return { method: method, args: decodedArgs, objectArgs: objectArgs, result: call[2] };
+  }
+
+  function load(trace, exglCtxId) {
+    gl = global.__EXGLContexts[String(exglCtxId)];
+    frames = trace.frames.map(function(frame) {
+      return frame.map(decodeCall);
+    });
+    bench.frameCount = frames.length;
+  }
+
+  // Lookup-heavy draw loop resembling what three.js issues for a scene of simple meshes:
+  // bind program, bind buffer, set up attribute, upload uniforms, draw. Every frame streams
+  // new vertex data into one of the buffers.
+  function synthetic(meshCount, frameCount) {
+    var VERTEX_SHADER =
+      'attribute vec2 position; uniform vec4 offset; void main() { gl_Position = vec4(position, 0.0, 1.0) + offset; }';
+    var FRAGMENT_SHADER =
+      'precision mediump float; uniform vec4 color; void main() { gl_FragColor = color; }';
+    var quad = [-0.1, -0.1, 0.1, -0.1, 0.1, 0.1, -0.1, -0.1, 0.1, 0.1, -0.1, 0.1];
+    var nextId = 1;
+
+    var setup = [
+      ['createShader', [gl.VERTEX_SHADER], nextId++],
+      ['shaderSource', [{ object: 1 }, VERTEX_SHADER]],
+      ['compileShader', [{ object: 1 }]],
+      ['createShader', [gl.FRAGMENT_SHADER], nextId++],
+      ['shaderSource', [{ object: 2 }, FRAGMENT_SHADER]],
+      ['compileShader', [{ object: 2 }]],
+      ['createProgram', [], nextId++],
+      ['attachShader', [{ object: 3 }, { object: 1 }]],
+      ['attachShader', [{ object: 3 }, { object: 2 }]],
+      ['bindAttribLocation', [{ object: 3 }, 0, 'position']],
+      ['linkProgram', [{ object: 3 }]],
+      // uniform locations aren't objects, but can be remapped the same way
+      ['getUniformLocation', [{ object: 3 }, 'offset'], nextId++],
+      ['getUniformLocation', [{ object: 3 }, 'color'], nextId++],
+      ['enableVertexAttribArray', [0]],
+    ];
+    var buffers = [];
+    for (var i = 0; i < meshCount; i++) {
+      var buffer = nextId++;
+      buffers.push(buffer);
+      setup.push(['createBuffer', [], buffer]);
+      setup.push(['bindBuffer', [gl.ARRAY_BUFFER, { object: buffer }]]);
+      setup.push(['bufferData', [gl.ARRAY_BUFFER, { Float32Array: quad }, gl.STATIC_DRAW]]);
+    }
+
+    var trace = { frames: [setup] };
+    for (var frame = 0; frame < frameCount; frame++) {
+      var calls = [
+        ['clearColor', [0, 0, 0, 1]],
+        ['clear', [gl.COLOR_BUFFER_BIT]],
+        ['bindBuffer', [gl.ARRAY_BUFFER, { object: buffers[frame % meshCount] }]],
+        ['bufferSubData', [gl.ARRAY_BUFFER, 0, { Float32Array: quad }]],
+      ];
+      for (var mesh = 0; mesh < meshCount; mesh++) {
+        var x = ((mesh % 32) / 16) - 1;
+        var y = (Math.floor(mesh / 32) % 32) / 16 - 1;
+        calls.push(['useProgram', [{ object: 3 }]]);
+        calls.push(['bindBuffer', [gl.ARRAY_BUFFER, { object: buffers[mesh] }]]);
+        calls.push(['vertexAttribPointer', [0, 2, gl.FLOAT, false, 0, 0]]);
+        calls.push(['uniform4fv', [{ object: 4 }, { Float32Array: [x, y, 0, 0] }]]);
+        calls.push(['uniform4f', [{ object: 5 }, x, y, 1, 1]]);
+        calls.push(['drawArrays', [gl.TRIANGLES, 0, 6]]);
+      }
+      trace.frames.push(calls);
+    }
+    return JSON.stringify(trace);
+  }
+
+  function runFrame(index) {
+    var calls = frames[index];
+    for (var i = 0; i < calls.length; i++) {
+      var call = calls[i];
+      var objectArgs = call.objectArgs;
+      for (var j = 0; j < objectArgs.length; j += 2) {
+        call.args[objectArgs[j]] = objectIds[objectArgs[j + 1]] || 0;
+      }
+      // counted before the call so that blocking calls are attributed to the batch they end
+      bench.calls++;
+      var result = call.method.apply(gl, call.args);
+      if (call.result !== undefined) {
+        objectIds[call.result] = result;
+      }
+    }
+    bench.calls++;
+    gl.endFrameEXP();
+    return calls.length + 1;
+  }
+
+  var bench = {
+    calls: 0,
+    frameCount: 0,
+    load: function(json, exglCtxId) {
+      load(JSON.parse(json), exglCtxId);
+    },
+    synthetic: function(exglCtxId, meshCount, frameCount) {
+      gl = global.__EXGLContexts[String(exglCtxId)];
+      load(JSON.parse(synthetic(meshCount, frameCount)), exglCtxId);
+    },
+    runFrame: runFrame,
+  };
+  global.__EXGLBench = bench;
+})(this);
@@ -1,6 +1,6 @@
 #pragma once
 
-#ifdef __ANDROID__
+#if defined(__ANDROID__) || defined(__linux__)
 #include <GLES3/gl3.h>
 #include <GLES3/gl3ext.h>
 #endif
@@ -12,6 +12,8 @@
 
 #include <jsi/jsi.h>
 
+#include <cstring>
+
 namespace expo {
 namespace gl_cpp {
 
@@ -57,12 +59,13 @@ inline jsi::Value EXGLContext::exglCall(Func func, T &&... args) {
   addToNextBatch([=, args = std::make_tuple(std::forward<T>(args)...)] {
     return std::apply(func, std::move(args));
   });
+  return nullptr;
 }
 
 template <typename Func, typename T>
 inline jsi::Value
-EXGLContext::exglUniformv(Func func, GLuint uniform, size_t dim, std::vector<T> &&data) {
-  addToNextBatch([=, data{std::move(data)}] { func(uniform, static_cast<int>(data.size() / dim), data.data()); });
+EXGLContext::exglUniformv(Func func, GLuint uniform, size_t dim, StagedData<T> data) {
+  addToNextBatch([=] { func(uniform, static_cast<int>(data.size / dim), data.data); });
   return nullptr;
 }
 
@@ -72,16 +75,41 @@ inline jsi::Value EXGLContext::exglUniformMatrixv(
     GLuint uniform,
     GLboolean transpose,
     size_t dim,
-    std::vector<T> &&data) {
-  addToNextBatch(
-      [=, data{std::move(data)}] { func(uniform, static_cast<int>(data.size() / dim), transpose, data.data()); });
+    StagedData<T> data) {
+  addToNextBatch([=] { func(uniform, static_cast<int>(data.size / dim), transpose, data.data); });
   return nullptr;
 }
 
 template <typename Func, typename T>
-inline jsi::Value EXGLContext::exglVertexAttribv(Func func, GLuint index, std::vector<T> &&data) {
-  addToNextBatch([=, data{std::move(data)}] { func(index, data.data()); });
+inline jsi::Value EXGLContext::exglVertexAttribv(Func func, GLuint index, StagedData<T> data) {
+  addToNextBatch([=] { func(index, data.data); });
   return nullptr;
 }
+
+template <typename T>
+inline EXGLContext::StagedData<T> EXGLContext::stageArray(
+    jsi::Runtime &runtime,
+    const jsi::Value &jsValue) {
+  auto jsObj = jsValue.asObject(runtime);
+  if (jsObj.isArray(runtime)) {
+    auto jsArray = jsObj.asArray(runtime);
+    size_t length = jsArray.length(runtime);
+    auto data = reinterpret_cast<T *>(allocateStaging(length * sizeof(T)));
+    for (size_t i = 0; i < length; i++) {
+      data[i] = static_cast<T>(jsArray.getValueAtIndex(runtime, i).asNumber());
+    }
+    return {data, length};
+  } else if (isTypedArray(runtime, jsObj)) {
+    constexpr TypedArrayKind kind = std::is_same_v<T, uint32_t>
+        ? TypedArrayKind::Uint32Array
+        : std::is_same_v<T, int32_t> ? TypedArrayKind::Int32Array : TypedArrayKind::Float32Array;
+    auto typedArray = getTypedArray(runtime, std::move(jsObj)).as<kind>(runtime);
+    size_t byteLength = typedArray.byteLength(runtime);
+    auto data = allocateStaging(byteLength);
+    std::memcpy(data, typedArray.data(runtime), byteLength);
+    return {reinterpret_cast<T *>(data), byteLength / sizeof(T)};
+  }
+  throw std::runtime_error("unsupported type");
+}
 } // namespace gl_cpp
 } // namespace expo
@@ -1,5 +1,7 @@
 #include "EXGLContext.h"
 
+#include <cstring>
+
 namespace expo {
 namespace gl_cpp {
 
@@ -7,8 +9,6 @@ static std::unordered_map<UEXGLContextId, EXGLContext *> EXGLContextMap;
 static std::mutex EXGLContextMapMutex;
 static UEXGLContextId EXGLContextNextId = 1;
 
-std::atomic_uint EXGLContext::nextObjectId{1};
-
 EXGLContext *EXGLContext::ContextGet(UEXGLContextId exglCtxId) {
   std::lock_guard<decltype(EXGLContextMapMutex)> lock(EXGLContextMapMutex);
   auto iter = EXGLContextMap.find(exglCtxId);
@@ -99,6 +99,27 @@ void EXGLContext::installConstants(jsi::Runtime &runtime, jsi::Object &jsGl) {
 #undef GL_CONSTANT
 };
 
+EXGLContext::StagedData<uint8_t> EXGLContext::stageBytes(
+    jsi::Runtime &runtime,
+    const jsi::Object &jsObj) {
+  uint8_t *src;
+  size_t size;
+  if (jsObj.isArrayBuffer(runtime)) {
+    auto buffer = jsObj.getArrayBuffer(runtime);
+    src = buffer.data(runtime);
+    size = buffer.size(runtime);
+  } else if (isTypedArray(runtime, jsObj)) {
+    auto typedArray = getTypedArray(runtime, jsObj);
+    src = typedArray.data(runtime);
+    size = typedArray.byteLength(runtime);
+  } else {
+    throw std::runtime_error("Object is not an ArrayBuffer nor a TypedArray");
+  }
+  uint8_t *data = allocateStaging(size);
+  std::memcpy(data, src, size);
+  return {data, size};
+}
+
 jsi::Value EXGLContext::exglIsObject(UEXGLObjectId id, std::function<GLboolean(GLuint)> func) {
   GLboolean glResult;
   addBlockingToNextBatch([&] { glResult = func(lookupObject(id)); });
@@ -107,8 +128,9 @@ jsi::Value EXGLContext::exglIsObject(UEXGLObjectId id, std::function<GLboolean(G
 
 jsi::Value EXGLContext::exglGenObject(
     jsi::Runtime &runtime,
+    EXGLObjectKind kind,
     std::function<void(GLsizei, UEXGLObjectId *)> func) {
-  return addFutureToNextBatch(runtime, [=] {
+  return addFutureToNextBatch(runtime, kind, [=] {
     GLuint buffer;
     func(1, &buffer);
     return buffer;
@@ -116,14 +138,20 @@ jsi::Value EXGLContext::exglGenObject(
   return nullptr;
 }
 
-jsi::Value EXGLContext::exglCreateObject(jsi::Runtime &runtime, std::function<GLuint()> func) {
-  return addFutureToNextBatch(runtime, [=] { return func(); });
+jsi::Value EXGLContext::exglCreateObject(
+    jsi::Runtime &runtime,
+    EXGLObjectKind kind,
+    std::function<GLuint()> func) {
+  return addFutureToNextBatch(runtime, kind, [=] { return func(); });
   return nullptr;
 }
 
 jsi::Value EXGLContext::exglDeleteObject(
     UEXGLObjectId id,
     std::function<void(UEXGLObjectId)> func) {
+  // Only shaders and programs are deleted this way. OpenGL defers their deletion while they are
+  // attached or in use and still reports them (e.g. in getAttachedShaders), so their ids are
+  // kept mapped and never reused.
   addToNextBatch([=] { func(lookupObject(id)); });
   return nullptr;
 }
@@ -134,7 +162,9 @@ jsi::Value EXGLContext::exglDeleteObject(
   addToNextBatch([=] {
     GLuint buffer = lookupObject(id);
     func(1, &buffer);
+    objects.unmap(id);
   });
+  releaseObject(id);
   return nullptr;
 }
 jsi::Value EXGLContext::exglUnimplemented(std::string name) {
@@ -1,6 +1,6 @@
 #include "UEXGL.h"
 
-#ifdef __ANDROID__
+#if defined(__ANDROID__) || defined(__linux__)
 #include <GLES3/gl3.h>
 #include <GLES3/gl3ext.h>
 #endif
@@ -12,6 +12,8 @@
 
 #include "TypedArrayApi.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <future>
 #include <sstream>
@@ -22,6 +24,7 @@
 #include <jsi/jsi.h>
 
 #include "EXGLNativeMethodsUtils.h"
+#include "EXGLObjectMap.h"
 #include "EXJSIUtils.h"
 #include "TypedArrayApi.h"
 
@@ -75,28 +78,93 @@ class EXGLContext {
   // The smallest unit of work
   using Op = std::function<void(void)>;
 
+  // Data uploaded to GL (buffers, uniforms, pixels) has to outlive the JS call that passed it
+  // in, so it is copied into a staging block owned by the batch. Blocks are returned to the pool
+  // once the batch is executed, so streaming similar amount of data every frame doesn't allocate.
+  struct StagingBlock {
+    std::unique_ptr<uint8_t[]> data;
+    size_t capacity = 0;
+    size_t used = 0;
+  };
+
+  static constexpr size_t kStagingBlockSize = 64 * 1024;
+  static constexpr size_t kMaxPooledStagingBytes = 16 * 1024 * 1024;
+
   // Ops are combined into batches:
   //   1. A batch is always executed entirely in one go on the GL thread
   //   2. The last add to a batch always precedes the first remove
   // #2 means that it's good to use an std::vector<...> for this
-  using Batch = std::vector<Op>;
+  struct Batch {
+    std::vector<Op> ops;
+    std::vector<StagingBlock> stagingBlocks;
+  };
 
   Batch nextBatch;
   std::vector<Batch> backlog;
   std::mutex backlogMutex;
 
+  std::vector<StagingBlock> stagingPool;
+  size_t stagingPoolBytes = 0;
+  std::mutex stagingPoolMutex;
+
   // [JS thread] Send the current 'next' batch to GL and make a new 'next' batch
   void endNextBatch() noexcept {
     std::lock_guard<std::mutex> lock(backlogMutex);
     backlog.push_back(std::move(nextBatch));
-    nextBatch = std::vector<Op>();
-    nextBatch.reserve(16); // default batch size
+    nextBatch = Batch();
+    nextBatch.ops.reserve(16); // default batch size
   }
 
   // [JS thread] Add an Op to the 'next' batch -- the arguments are any form of
   // constructor arguments for Op
   void addToNextBatch(Op &&op) noexcept {
-    nextBatch.push_back(std::move(op));
+    nextBatch.ops.push_back(std::move(op));
+  }
+
+  // [JS thread] Reserve memory that stays valid until the 'next' batch is executed on GL thread
+  uint8_t *allocateStaging(size_t size) {
+    // keep every allocation aligned so it can hold any of the GL data types
+    size = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    auto &blocks = nextBatch.stagingBlocks;
+    if (blocks.empty() || blocks.back().capacity - blocks.back().used < size) {
+      blocks.push_back(acquireStagingBlock(size));
+    }
+    auto &block = blocks.back();
+    uint8_t *ptr = block.data.get() + block.used;
+    block.used += size;
+    return ptr;
+  }
+
+  // [JS thread] Take a block that can fit at least `size` bytes from the pool or allocate a new one
+  StagingBlock acquireStagingBlock(size_t size) {
+    {
+      std::lock_guard<std::mutex> lock(stagingPoolMutex);
+      for (auto iter = stagingPool.begin(); iter != stagingPool.end(); iter++) {
+        if (iter->capacity >= size) {
+          StagingBlock block = std::move(*iter);
+          stagingPool.erase(iter);
+          stagingPoolBytes -= block.capacity;
+          return block;
+        }
+      }
+    }
+    StagingBlock block;
+    block.capacity = std::max(size, kStagingBlockSize);
+    block.data = std::unique_ptr<uint8_t[]>(new uint8_t[block.capacity]);
+    return block;
+  }
+
+  // [GL thread] Return blocks of the executed batch to the pool
+  void recycleStagingBlocks(std::vector<StagingBlock> &&blocks) {
+    std::lock_guard<std::mutex> lock(stagingPoolMutex);
+    for (auto &block : blocks) {
+      if (stagingPoolBytes + block.capacity > kMaxPooledStagingBytes) {
+        continue;
+      }
+      block.used = 0;
+      stagingPoolBytes += block.capacity;
+      stagingPool.push_back(std::move(block));
+    }
   }
 
   // [JS thread] Add a blocking operation to the 'next' batch -- waits for the
@@ -124,11 +192,12 @@ class EXGLContext {
   //
   inline jsi::Value addFutureToNextBatch(
       jsi::Runtime &runtime,
+      EXGLObjectKind kind,
       std::function<unsigned int(void)> &&op) noexcept {
     auto exglObjId = createObject();
     addToNextBatch([=] {
-      assert(objects.find(exglObjId) == objects.end());
-      mapObject(exglObjId, op());
+      assert(lookupObject(exglObjId) == 0);
+      mapObject(exglObjId, op(), kind);
     });
     return static_cast<double>(exglObjId);
   }
@@ -145,46 +214,85 @@ class EXGLContext {
       std::lock_guard<std::mutex> lock(backlogMutex);
       std::swap(backlog, copy);
     }
-    for (const auto &batch : copy) {
-      for (const auto &op : batch) {
+    for (auto &batch : copy) {
+      for (const auto &op : batch.ops) {
         op();
       }
+      recycleStagingBlocks(std::move(batch.stagingBlocks));
     }
   }
 
+  // --- Staged data -----------------------------------------------------------
+
+  // View of data copied into the staging memory of the 'next' batch, it's safe to capture it
+  // in ops of that batch.
+  template <typename T>
+  struct StagedData {
+    T *data;
+    size_t size;
+  };
+
+  // [JS thread] Copy contents of an ArrayBuffer or a TypedArray into staging memory
+  StagedData<uint8_t> stageBytes(jsi::Runtime &runtime, const jsi::Object &jsObj);
+
+  // [JS thread] Copy a JS array or a TypedArray of a matching kind into staging memory
+  template <typename T>
+  inline StagedData<T> stageArray(jsi::Runtime &runtime, const jsi::Value &jsValue);
+
   // --- Object mapping --------------------------------------------------------
 
-  // We err on the side of performance and hope that a global incrementing atomic
-  // unsigned int is enough for object ids. On 'creating' an object we simply
-  // 'reserve' the id by incrementing the atomic counter. Since the mapping is only
-  // set and read on the GL thread, this prevents us from having to maintain a
-  // mutex on the mapping.
+  // On 'creating' an object we simply 'reserve' an id, the OpenGL object is mapped to it later
+  // on the GL thread. Since the mapping is only set and read on the GL thread, this prevents us
+  // from having to maintain a mutex on the mapping. Deleted objects give their id back, see
+  // EXGLObjectMap for how reused ids are told apart.
 
  private:
-  std::unordered_map<UEXGLObjectId, GLuint> objects;
-  static std::atomic_uint nextObjectId;
+  EXGLObjectMap objects;
 
  public:
   inline UEXGLObjectId createObject(void) noexcept {
-    return nextObjectId++;
+    return objects.create();
   }
 
+  // Used by the platform code that maps objects itself (e.g. camera textures)
   inline void destroyObject(UEXGLObjectId exglObjId) noexcept {
-    objects.erase(exglObjId);
+    objects.unmap(exglObjId);
+    objects.release(exglObjId);
+  }
+
+  // Make the id available for reuse, ops queued before still see the old mapping
+  inline void releaseObject(UEXGLObjectId exglObjId) noexcept {
+    objects.release(exglObjId);
   }
 
-  inline void mapObject(UEXGLObjectId exglObjId, GLuint glObj) noexcept {
-    objects[exglObjId] = glObj;
+  inline void mapObject(UEXGLObjectId exglObjId, GLuint glObj, EXGLObjectKind kind) noexcept {
+    objects.map(exglObjId, glObj, kind);
   }
 
   inline GLuint lookupObject(UEXGLObjectId exglObjId) noexcept {
-    auto iter = objects.find(exglObjId);
-    return iter == objects.end() ? 0 : iter->second;
+    return objects.lookup(exglObjId);
+  }
+
+  // Reverse lookup, returns 0 if there is no EXGL object mapped to the given OpenGL object
+  inline UEXGLObjectId findObject(GLuint glObj, EXGLObjectKind kind) noexcept {
+    return objects.find(glObj, kind);
+  }
+
+  inline void destroySync(UEXGLObjectId exglObjId) noexcept {
+    objects.unmapSync(exglObjId);
+  }
+
+  inline void mapSync(UEXGLObjectId exglObjId, GLsync glSync) noexcept {
+    objects.mapSync(exglObjId, glSync);
+  }
+
+  inline GLsync lookupSync(UEXGLObjectId exglObjId) noexcept {
+    return objects.lookupSync(exglObjId);
   }
 
   // --- Init/destroy and JS object binding ------------------------------------
  private:
-  std::set<const std::string> supportedExtensions;
+  std::set<std::string> supportedExtensions;
   bool supportsWebGL2 = false;
 
  public:
@@ -238,6 +346,14 @@ class EXGLContext {
     });
   }
 
+  // [GL thread] Run the queued work and delete the OpenGL objects that would outlive the context
+  void prepareForDestroy() {
+    flush();
+    for (auto glSync : objects.takeSyncs()) {
+      glDeleteSync(glSync);
+    }
+  }
+
   static EXGLContext *ContextGet(UEXGLContextId exglCtxId);
   static UEXGLContextId ContextCreate(jsi::Runtime &runtime);
   static void ContextDestroy(UEXGLContextId exglCtxId);
@@ -273,15 +389,18 @@ class EXGLContext {
   inline jsi::Value exglGetActiveInfo(jsi::Runtime &, UEXGLObjectId, GLuint, GLenum, Func);
 
   template <typename Func, typename T>
-  inline jsi::Value exglUniformv(Func, GLuint, size_t, std::vector<T> &&);
+  inline jsi::Value exglUniformv(Func, GLuint, size_t, StagedData<T>);
   template <typename Func, typename T>
-  inline jsi::Value exglUniformMatrixv(Func, GLuint, GLboolean, size_t, std::vector<T> &&);
+  inline jsi::Value exglUniformMatrixv(Func, GLuint, GLboolean, size_t, StagedData<T>);
   template <typename Func, typename T>
-  inline jsi::Value exglVertexAttribv(Func func, GLuint, std::vector<T> &&);
+  inline jsi::Value exglVertexAttribv(Func func, GLuint, StagedData<T>);
 
   jsi::Value exglIsObject(UEXGLObjectId id, std::function<GLboolean(GLuint)>);
-  jsi::Value exglCreateObject(jsi::Runtime &, std::function<GLuint()>);
-  jsi::Value exglGenObject(jsi::Runtime &, std::function<void(GLsizei, UEXGLObjectId *)>);
+  jsi::Value exglCreateObject(jsi::Runtime &, EXGLObjectKind, std::function<GLuint()>);
+  jsi::Value exglGenObject(
+      jsi::Runtime &,
+      EXGLObjectKind,
+      std::function<void(GLsizei, UEXGLObjectId *)>);
   jsi::Value exglDeleteObject(UEXGLObjectId id, std::function<void(UEXGLObjectId)>);
   jsi::Value exglDeleteObject(UEXGLObjectId, std::function<void(GLsizei, const UEXGLObjectId *)>);
 
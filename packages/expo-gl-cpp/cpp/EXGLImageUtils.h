@@ -1,6 +1,6 @@
 #pragma once
 
-#ifdef __ANDROID__
+#if defined(__ANDROID__) || defined(__linux__)
 #include <GLES3/gl3.h>
 #include <GLES3/gl3ext.h>
 #endif
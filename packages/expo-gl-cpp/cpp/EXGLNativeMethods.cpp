@@ -2,6 +2,7 @@
 #include "EXGLImageUtils.h"
 
 #include <algorithm>
+#include <cstring>
 
 #define ARG(index, type)                                   \
   (argc > index ? unpackArg<type>(runtime, jsArgv + index) \
@@ -183,10 +184,10 @@ NATIVE_METHOD(getParameter) {
     case GL_CURRENT_PROGRAM: {
       GLint glInt;
       addBlockingToNextBatch([&] { glGetIntegerv(pname, &glInt); });
-      for (const auto &pair : objects) {
-        if (static_cast<int>(pair.second) == glInt) {
-          return static_cast<double>(pair.first);
-        }
+      auto kind = pname == GL_CURRENT_PROGRAM ? EXGLObjectKind::Program : EXGLObjectKind::Buffer;
+      UEXGLObjectId exglObjId = findObject(glInt, kind);
+      if (exglObjId != 0) {
+        return static_cast<double>(exglObjId);
       }
       return nullptr;
     }
@@ -285,9 +286,8 @@ NATIVE_METHOD(bufferData) {
   } else if (sizeOrData.isNull() || sizeOrData.isUndefined()) {
     addToNextBatch([=] { glBufferData(target, 0, nullptr, usage); });
   } else if (sizeOrData.isObject()) {
-    auto data = rawTypedArray(runtime, sizeOrData.getObject(runtime));
-    addToNextBatch(
-        [=, data{std::move(data)}] { glBufferData(target, data.size(), data.data(), usage); });
+    auto data = stageBytes(runtime, sizeOrData.getObject(runtime));
+    addToNextBatch([=] { glBufferData(target, data.size, data.data, usage); });
   }
   return nullptr;
 }
@@ -298,15 +298,14 @@ NATIVE_METHOD(bufferSubData) {
   if (ARG(2, const jsi::Value &).isNull()) {
     addToNextBatch([=] { glBufferSubData(target, offset, 0, nullptr); });
   } else {
-    auto data = rawTypedArray(runtime, ARG(2, jsi::Object));
-    addToNextBatch(
-        [=, data{std::move(data)}] { glBufferSubData(target, offset, data.size(), data.data()); });
+    auto data = stageBytes(runtime, ARG(2, jsi::Object));
+    addToNextBatch([=] { glBufferSubData(target, offset, data.size, data.data); });
   }
   return nullptr;
 }
 
 NATIVE_METHOD(createBuffer) {
-  return exglGenObject(runtime, glGenBuffers);
+  return exglGenObject(runtime, EXGLObjectKind::Buffer, glGenBuffers);
 }
 
 NATIVE_METHOD(deleteBuffer) {
@@ -331,8 +330,49 @@ SIMPLE_NATIVE_METHOD(
     copyBufferSubData,
     glCopyBufferSubData) // readTarget, writeTarget, readOffset, writeOffset, size
 
-// glGetBufferSubData is not available in OpenGL ES
-UNIMPL_NATIVE_METHOD(getBufferSubData);
+// glGetBufferSubData is not available in OpenGL ES, the buffer is mapped and copied directly into
+// the destination TypedArray instead. Combined with readPixels into PIXEL_PACK_BUFFER and fenceSync
+// it allows to read pixels back without stalling JS thread until the data is actually needed.
+NATIVE_METHOD(getBufferSubData) {
+  auto target = ARG(0, GLenum);
+  auto srcByteOffset = ARG(1, GLintptr);
+  TypedArrayBase dstData = ARG(2, TypedArrayBase);
+  size_t dstOffset = argc > 3 ? ARG(3, GLuint) : 0;
+  size_t length = argc > 4 ? ARG(4, GLuint) : 0;
+
+  size_t elementCount = dstData.length(runtime);
+  if (elementCount == 0) {
+    return nullptr;
+  }
+  size_t elementSize = dstData.byteLength(runtime) / elementCount;
+  if (dstOffset > elementCount) {
+    throw std::runtime_error("EXGL: dstOffset is larger than the length of dstData");
+  }
+  if (length == 0) {
+    length = elementCount - dstOffset;
+  } else if (dstOffset + length > elementCount) {
+    throw std::runtime_error("EXGL: dstOffset + length is larger than the length of dstData");
+  }
+  GLsizeiptr byteLength = length * elementSize;
+
+  // JS thread is blocked until the operation below completes, so we can safely write
+  // directly into the storage of the ArrayBuffer
+  jsi::ArrayBuffer buffer = dstData.getBuffer(runtime);
+  uint8_t *dst = buffer.data(runtime) + dstData.byteOffset(runtime) + dstOffset * elementSize;
+
+  bool mapped = false;
+  addBlockingToNextBatch([&] {
+    void *src = glMapBufferRange(target, srcByteOffset, byteLength, GL_MAP_READ_BIT);
+    if (src != nullptr) {
+      std::memcpy(dst, src, byteLength);
+      mapped = glUnmapBuffer(target) == GL_TRUE;
+    }
+  });
+  if (!mapped) {
+    throw std::runtime_error("EXGL: Failed to map buffer data");
+  }
+  return nullptr;
+}
 
 // Framebuffers
 // ------------
@@ -354,7 +394,7 @@ NATIVE_METHOD(checkFramebufferStatus) {
 }
 
 NATIVE_METHOD(createFramebuffer) {
-  return exglGenObject(runtime, glGenFramebuffers);
+  return exglGenObject(runtime, EXGLObjectKind::Framebuffer, glGenFramebuffers);
 }
 
 NATIVE_METHOD(deleteFramebuffer) {
@@ -398,13 +438,36 @@ NATIVE_METHOD(readPixels) {
   auto height = ARG(3, GLuint);
   auto format = ARG(4, GLenum);
   auto type = ARG(5, GLenum);
-  size_t byteLength = width * height * bytesPerPixel(type, format);
-  std::vector<uint8_t> pixels(byteLength);
-  addBlockingToNextBatch([&] { glReadPixels(x, y, width, height, format, type, pixels.data()); });
 
+  if (ARG(6, const jsi::Value &).isNumber()) {
+    // WebGL2 overload, pixels are written into the buffer bound to PIXEL_PACK_BUFFER at the given
+    // offset. The transfer is handled asynchronously by the driver so we don't need to wait for it,
+    // the result can be read later with getBufferSubData (preferably after fenceSync is signaled).
+    auto offset = ARG(6, GLintptr);
+    addToNextBatch([=] {
+      glReadPixels(x, y, width, height, format, type, reinterpret_cast<GLvoid *>(offset));
+    });
+    return nullptr;
+  }
+
+  size_t byteLength = width * height * bytesPerPixel(type, format);
   TypedArrayBase arr = ARG(6, TypedArrayBase);
+  size_t byteOffset = arr.byteOffset(runtime);
+  if (argc > 7) {
+    size_t elementCount = arr.length(runtime);
+    size_t elementSize = elementCount > 0 ? arr.byteLength(runtime) / elementCount : 0;
+    byteOffset += ARG(7, GLuint) * elementSize;
+  }
+
   jsi::ArrayBuffer buffer = arr.getBuffer(runtime);
-  arrayBufferUpdate(runtime, buffer, pixels, arr.byteOffset(runtime));
+  if (byteOffset + byteLength > buffer.size(runtime)) {
+    throw std::runtime_error("EXGL: ArrayBuffer is too small to fit data");
+  }
+
+  // JS thread is blocked until the operation below completes, so pixels can be read directly into
+  // the storage of the ArrayBuffer without an intermediate copy
+  uint8_t *pixels = buffer.data(runtime) + byteOffset;
+  addBlockingToNextBatch([&] { glReadPixels(x, y, width, height, format, type, pixels); });
   return nullptr;
 }
 
@@ -470,7 +533,7 @@ NATIVE_METHOD(bindRenderbuffer) {
 }
 
 NATIVE_METHOD(createRenderbuffer) {
-  return exglGenObject(runtime, glGenRenderbuffers);
+  return exglGenObject(runtime, EXGLObjectKind::Renderbuffer, glGenRenderbuffers);
 }
 
 NATIVE_METHOD(deleteRenderbuffer) {
@@ -541,7 +604,7 @@ SIMPLE_NATIVE_METHOD(
     glCopyTexSubImage2D) // target, level, xoffset, yoffset, x, y, width, height
 
 NATIVE_METHOD(createTexture) {
-  return exglGenObject(runtime, glGenTextures);
+  return exglGenObject(runtime, EXGLObjectKind::Texture, glGenTextures);
 }
 
 NATIVE_METHOD(deleteTexture) {
@@ -575,13 +638,13 @@ NATIVE_METHOD(texImage2D, 6) {
     auto data = ARG(8, jsi::Object);
 
     if (data.isArrayBuffer(runtime) || isTypedArray(runtime, data)) {
-      std::vector<uint8_t> vec = rawTypedArray(runtime, std::move(data));
+      auto staged = stageBytes(runtime, data);
       if (unpackFLipY) {
-        flipPixels(vec.data(), width * bytesPerPixel(type, format), height);
+        flipPixels(staged.data, width * bytesPerPixel(type, format), height);
       }
-      addToNextBatch([=, vec{std::move(vec)}] {
+      addToNextBatch([=] {
         glTexImage2D(
-            target, level, internalformat, width, height, border, format, type, vec.data());
+            target, level, internalformat, width, height, border, format, type, staged.data);
       });
     } else {
       auto image = loadImage(runtime, data, &width, &height, nullptr);
@@ -633,12 +696,12 @@ NATIVE_METHOD(texSubImage2D, 6) {
     auto data = ARG(8, jsi::Object);
 
     if (data.isArrayBuffer(runtime) || isTypedArray(runtime, data)) {
-      std::vector<uint8_t> vec = rawTypedArray(runtime, std::move(data));
+      auto staged = stageBytes(runtime, data);
       if (unpackFLipY) {
-        flipPixels(vec.data(), width * bytesPerPixel(type, format), height);
+        flipPixels(staged.data, width * bytesPerPixel(type, format), height);
       }
-      addToNextBatch([=, vec{std::move(vec)}] {
-        glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, vec.data());
+      addToNextBatch([=] {
+        glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, staged.data);
       });
     } else {
       auto image = loadImage(runtime, data, &width, &height, nullptr);
@@ -708,13 +771,13 @@ NATIVE_METHOD(texImage3D) {
   };
 
   if (data.isArrayBuffer(runtime) || isTypedArray(runtime, data)) {
-    std::vector<uint8_t> vec = rawTypedArray(runtime, std::move(data));
+    auto staged = stageBytes(runtime, data);
     if (unpackFLipY) {
-      flip(vec.data());
+      flip(staged.data);
     }
-    addToNextBatch([=, vec{std::move(vec)}] {
+    addToNextBatch([=] {
       glTexImage3D(
-          target, level, internalformat, width, height, depth, border, format, type, vec.data());
+          target, level, internalformat, width, height, depth, border, format, type, staged.data);
     });
   } else {
     auto image = loadImage(runtime, data, &width, &height, nullptr);
@@ -761,13 +824,23 @@ NATIVE_METHOD(texSubImage3D) {
   };
 
   if (data.isArrayBuffer(runtime) || isTypedArray(runtime, data)) {
-    std::vector<uint8_t> vec = rawTypedArray(runtime, std::move(data));
+    auto staged = stageBytes(runtime, data);
     if (unpackFLipY) {
-      flip(vec.data());
+      flip(staged.data);
     }
-    addToNextBatch([=, vec{std::move(vec)}] {
+    addToNextBatch([=] {
       glTexSubImage3D(
-          target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, vec.data());
+          target,
+          level,
+          xoffset,
+          yoffset,
+          zoffset,
+          width,
+          height,
+          depth,
+          format,
+          type,
+          staged.data);
     });
   } else {
     auto image = loadImage(runtime, data, &width, &height, nullptr);
@@ -827,13 +900,13 @@ NATIVE_METHOD(compileShader) {
 }
 
 NATIVE_METHOD(createProgram) {
-  return exglCreateObject(runtime, glCreateProgram);
+  return exglCreateObject(runtime, EXGLObjectKind::Program, glCreateProgram);
 }
 
 NATIVE_METHOD(createShader) {
   auto type = ARG(0, GLenum);
   if (type == GL_VERTEX_SHADER || type == GL_FRAGMENT_SHADER) {
-    return exglCreateObject(runtime, std::bind(glCreateShader, type));
+    return exglCreateObject(runtime, EXGLObjectKind::Shader, std::bind(glCreateShader, type));
   } else {
     throw std::runtime_error("unknown shader type passed to function");
   }
@@ -868,12 +941,7 @@ NATIVE_METHOD(getAttachedShaders) {
 
   jsi::Array jsResults(runtime, count);
   for (auto i = 0; i < count; ++i) {
-    UEXGLObjectId exglObjId = 0;
-    for (const auto &pair : objects) {
-      if (pair.second == glResults[i]) {
-        exglObjId = pair.first;
-      }
-    }
+    UEXGLObjectId exglObjId = findObject(glResults[i], EXGLObjectKind::Shader);
     if (exglObjId == 0) {
       throw std::runtime_error(
           "EXGL: Internal error: couldn't find UEXGLObjectId "
@@ -1068,66 +1136,90 @@ SIMPLE_NATIVE_METHOD(uniform3i, glUniform3i); // uniform, x, y, z
 SIMPLE_NATIVE_METHOD(uniform4i, glUniform4i); // uniform, x, y, z, w
 
 NATIVE_METHOD(uniform1fv) {
-  return exglUniformv(glUniform1fv, ARG(0, GLuint), 1, ARG(1, std::vector<float>));
+  return exglUniformv(
+      glUniform1fv, ARG(0, GLuint), 1, stageArray<float>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform2fv) {
-  return exglUniformv(glUniform2fv, ARG(0, GLuint), 2, ARG(1, std::vector<float>));
+  return exglUniformv(
+      glUniform2fv, ARG(0, GLuint), 2, stageArray<float>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform3fv) {
-  return exglUniformv(glUniform3fv, ARG(0, GLuint), 3, ARG(1, std::vector<float>));
+  return exglUniformv(
+      glUniform3fv, ARG(0, GLuint), 3, stageArray<float>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform4fv) {
-  return exglUniformv(glUniform4fv, ARG(0, GLuint), 4, ARG(1, std::vector<float>));
+  return exglUniformv(
+      glUniform4fv, ARG(0, GLuint), 4, stageArray<float>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform1iv) {
-  return exglUniformv(glUniform1iv, ARG(0, GLuint), 1, ARG(1, std::vector<int32_t>));
+  return exglUniformv(
+      glUniform1iv, ARG(0, GLuint), 1, stageArray<int32_t>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform2iv) {
-  return exglUniformv(glUniform2iv, ARG(0, GLuint), 2, ARG(1, std::vector<int32_t>));
+  return exglUniformv(
+      glUniform2iv, ARG(0, GLuint), 2, stageArray<int32_t>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform3iv) {
-  return exglUniformv(glUniform3iv, ARG(0, GLuint), 3, ARG(1, std::vector<int32_t>));
+  return exglUniformv(
+      glUniform3iv, ARG(0, GLuint), 3, stageArray<int32_t>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform4iv) {
-  return exglUniformv(glUniform4iv, ARG(0, GLuint), 4, ARG(1, std::vector<int32_t>));
+  return exglUniformv(
+      glUniform4iv, ARG(0, GLuint), 4, stageArray<int32_t>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniformMatrix2fv) {
   return exglUniformMatrixv(
-      glUniformMatrix2fv, ARG(0, GLuint), ARG(1, GLboolean), 4, ARG(2, std::vector<float>));
+      glUniformMatrix2fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      4,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 NATIVE_METHOD(uniformMatrix3fv) {
   return exglUniformMatrixv(
-      glUniformMatrix3fv, ARG(0, GLuint), ARG(1, GLboolean), 9, ARG(2, std::vector<float>));
+      glUniformMatrix3fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      9,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 NATIVE_METHOD(uniformMatrix4fv) {
   return exglUniformMatrixv(
-      glUniformMatrix4fv, ARG(0, GLuint), ARG(1, GLboolean), 16, ARG(2, std::vector<float>));
+      glUniformMatrix4fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      16,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 NATIVE_METHOD(vertexAttrib1fv) {
-  return exglVertexAttribv(glVertexAttrib1fv, ARG(0, GLuint), ARG(1, std::vector<float>));
+  return exglVertexAttribv(
+      glVertexAttrib1fv, ARG(0, GLuint), stageArray<float>(runtime, ARG(1, const jsi::Value &)));
 }
 
 NATIVE_METHOD(vertexAttrib2fv) {
-  return exglVertexAttribv(glVertexAttrib2fv, ARG(0, GLuint), ARG(1, std::vector<float>));
+  return exglVertexAttribv(
+      glVertexAttrib2fv, ARG(0, GLuint), stageArray<float>(runtime, ARG(1, const jsi::Value &)));
 }
 
 NATIVE_METHOD(vertexAttrib3fv) {
-  return exglVertexAttribv(glVertexAttrib3fv, ARG(0, GLuint), ARG(1, std::vector<float>));
+  return exglVertexAttribv(
+      glVertexAttrib3fv, ARG(0, GLuint), stageArray<float>(runtime, ARG(1, const jsi::Value &)));
 }
 
 NATIVE_METHOD(vertexAttrib4fv) {
-  return exglVertexAttribv(glVertexAttrib4fv, ARG(0, GLuint), ARG(1, std::vector<float>));
+  return exglVertexAttribv(
+      glVertexAttrib4fv, ARG(0, GLuint), stageArray<float>(runtime, ARG(1, const jsi::Value &)));
 }
 
 SIMPLE_NATIVE_METHOD(vertexAttrib1f, glVertexAttrib1f); // index, x
@@ -1148,60 +1240,92 @@ SIMPLE_NATIVE_METHOD(uniform3ui, glUniform3ui); // location, x, y, z
 SIMPLE_NATIVE_METHOD(uniform4ui, glUniform4ui); // location, x, y, z, w
 
 NATIVE_METHOD(uniform1uiv) {
-  return exglUniformv(glUniform1uiv, ARG(0, GLuint), 1, ARG(1, std::vector<uint32_t>));
+  return exglUniformv(
+      glUniform1uiv, ARG(0, GLuint), 1, stageArray<uint32_t>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform2uiv) {
-  return exglUniformv(glUniform2uiv, ARG(0, GLuint), 2, ARG(1, std::vector<uint32_t>));
+  return exglUniformv(
+      glUniform2uiv, ARG(0, GLuint), 2, stageArray<uint32_t>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform3uiv) {
-  return exglUniformv(glUniform3uiv, ARG(0, GLuint), 3, ARG(1, std::vector<uint32_t>));
+  return exglUniformv(
+      glUniform3uiv, ARG(0, GLuint), 3, stageArray<uint32_t>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniform4uiv) {
-  return exglUniformv(glUniform4uiv, ARG(0, GLuint), 4, ARG(1, std::vector<uint32_t>));
+  return exglUniformv(
+      glUniform4uiv, ARG(0, GLuint), 4, stageArray<uint32_t>(runtime, ARG(1, const jsi::Value &)));
 };
 
 NATIVE_METHOD(uniformMatrix3x2fv) {
   return exglUniformMatrixv(
-      glUniformMatrix3x2fv, ARG(0, GLuint), ARG(1, GLboolean), 6, ARG(2, std::vector<float>));
+      glUniformMatrix3x2fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      6,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 NATIVE_METHOD(uniformMatrix4x2fv) {
   return exglUniformMatrixv(
-      glUniformMatrix4x2fv, ARG(0, GLuint), ARG(1, GLboolean), 8, ARG(2, std::vector<float>));
+      glUniformMatrix4x2fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      8,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 NATIVE_METHOD(uniformMatrix2x3fv) {
   return exglUniformMatrixv(
-      glUniformMatrix2x3fv, ARG(0, GLuint), ARG(1, GLboolean), 6, ARG(2, std::vector<float>));
+      glUniformMatrix2x3fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      6,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 NATIVE_METHOD(uniformMatrix4x3fv) {
   return exglUniformMatrixv(
-      glUniformMatrix4x3fv, ARG(0, GLuint), ARG(1, GLboolean), 12, ARG(2, std::vector<float>));
+      glUniformMatrix4x3fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      12,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 NATIVE_METHOD(uniformMatrix2x4fv) {
   return exglUniformMatrixv(
-      glUniformMatrix2x4fv, ARG(0, GLuint), ARG(1, GLboolean), 8, ARG(2, std::vector<float>));
+      glUniformMatrix2x4fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      8,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 NATIVE_METHOD(uniformMatrix3x4fv) {
   return exglUniformMatrixv(
-      glUniformMatrix3x4fv, ARG(0, GLuint), ARG(1, GLboolean), 12, ARG(2, std::vector<float>));
+      glUniformMatrix3x4fv,
+      ARG(0, GLuint),
+      ARG(1, GLboolean),
+      12,
+      stageArray<float>(runtime, ARG(2, const jsi::Value &)));
 }
 
 SIMPLE_NATIVE_METHOD(vertexAttribI4i, glVertexAttribI4i); // index, x, y, z, w
 SIMPLE_NATIVE_METHOD(vertexAttribI4ui, glVertexAttribI4ui); // index, x, y, z, w
 
 NATIVE_METHOD(vertexAttribI4iv) {
-  return exglVertexAttribv(glVertexAttribI4iv, ARG(0, GLuint), ARG(1, std::vector<int32_t>));
+  return exglVertexAttribv(
+      glVertexAttribI4iv, ARG(0, GLuint), stageArray<int32_t>(runtime, ARG(1, const jsi::Value &)));
 }
 
 NATIVE_METHOD(vertexAttribI4uiv) {
-  return exglVertexAttribv(glVertexAttribI4uiv, ARG(0, GLuint), ARG(1, std::vector<uint32_t>));
+  return exglVertexAttribv(
+      glVertexAttribI4uiv,
+      ARG(0, GLuint),
+      stageArray<uint32_t>(runtime, ARG(1, const jsi::Value &)));
 }
 
 SIMPLE_NATIVE_METHOD(
@@ -1248,27 +1372,24 @@ NATIVE_METHOD(drawBuffers) {
 NATIVE_METHOD(clearBufferfv) {
   auto buffer = ARG(0, GLenum);
   auto drawbuffer = ARG(1, GLint);
-  auto values = ARG(2, TypedArrayKind::Float32Array).toVector(runtime);
-  addToNextBatch(
-      [=, values{std::move(values)}] { glClearBufferfv(buffer, drawbuffer, values.data()); });
+  auto values = stageArray<float>(runtime, ARG(2, const jsi::Value &));
+  addToNextBatch([=] { glClearBufferfv(buffer, drawbuffer, values.data); });
   return nullptr;
 }
 
 NATIVE_METHOD(clearBufferiv) {
   auto buffer = ARG(0, GLenum);
   auto drawbuffer = ARG(1, GLint);
-  auto values = ARG(2, TypedArrayKind::Int32Array).toVector(runtime);
-  addToNextBatch(
-      [=, values{std::move(values)}] { glClearBufferiv(buffer, drawbuffer, values.data()); });
+  auto values = stageArray<int32_t>(runtime, ARG(2, const jsi::Value &));
+  addToNextBatch([=] { glClearBufferiv(buffer, drawbuffer, values.data); });
   return nullptr;
 }
 
 NATIVE_METHOD(clearBufferuiv) {
   auto buffer = ARG(0, GLenum);
   auto drawbuffer = ARG(1, GLint);
-  auto values = ARG(2, TypedArrayKind::Uint32Array).toVector(runtime);
-  addToNextBatch(
-      [=, values{std::move(values)}] { glClearBufferuiv(buffer, drawbuffer, values.data()); });
+  auto values = stageArray<uint32_t>(runtime, ARG(2, const jsi::Value &));
+  addToNextBatch([=] { glClearBufferuiv(buffer, drawbuffer, values.data); });
   return nullptr;
 }
 
@@ -1278,7 +1399,7 @@ SIMPLE_NATIVE_METHOD(clearBufferfi, glClearBufferfi); // buffer, drawbuffer, dep
 // ----------------------
 
 NATIVE_METHOD(createQuery) {
-  return exglGenObject(runtime, glGenQueries);
+  return exglGenObject(runtime, EXGLObjectKind::Query, glGenQueries);
 }
 
 NATIVE_METHOD(deleteQuery) {
@@ -1318,7 +1439,7 @@ NATIVE_METHOD(getQueryParameter) {
 // -----------------
 
 NATIVE_METHOD(createSampler) {
-  return exglGenObject(runtime, glGenSamplers);
+  return exglGenObject(runtime, EXGLObjectKind::Sampler, glGenSamplers);
 }
 
 NATIVE_METHOD(deleteSampler) {
@@ -1374,23 +1495,60 @@ NATIVE_METHOD(getSamplerParameter) {
 // Sync objects (WebGL2)
 // ---------------------
 
-UNIMPL_NATIVE_METHOD(fenceSync)
+NATIVE_METHOD(fenceSync) {
+  auto condition = ARG(0, GLenum);
+  auto flags = ARG(1, GLbitfield);
+  auto exglObjId = createObject();
+  addToNextBatch([=] { mapSync(exglObjId, glFenceSync(condition, flags)); });
+  return static_cast<double>(exglObjId);
+}
 
-UNIMPL_NATIVE_METHOD(isSync)
+NATIVE_METHOD(isSync) {
+  auto sync = ARG(0, UEXGLObjectId);
+  GLboolean glResult;
+  addBlockingToNextBatch([&] { glResult = glIsSync(lookupSync(sync)); });
+  return glResult == GL_TRUE;
+}
 
-UNIMPL_NATIVE_METHOD(deleteSync)
+NATIVE_METHOD(deleteSync) {
+  auto sync = ARG(0, UEXGLObjectId);
+  addToNextBatch([=] {
+    glDeleteSync(lookupSync(sync));
+    destroySync(sync);
+  });
+  releaseObject(sync);
+  return nullptr;
+}
 
-UNIMPL_NATIVE_METHOD(clientWaitSync)
+NATIVE_METHOD(clientWaitSync) {
+  auto sync = ARG(0, UEXGLObjectId);
+  auto flags = ARG(1, GLbitfield);
+  auto timeout = ARG(2, GLuint64);
+  GLenum glResult;
+  addBlockingToNextBatch([&] { glResult = glClientWaitSync(lookupSync(sync), flags, timeout); });
+  return static_cast<double>(glResult);
+}
 
-UNIMPL_NATIVE_METHOD(waitSync)
+NATIVE_METHOD(waitSync) {
+  auto sync = ARG(0, UEXGLObjectId);
+  auto flags = ARG(1, GLbitfield);
+  addToNextBatch([=] { glWaitSync(lookupSync(sync), flags, GL_TIMEOUT_IGNORED); });
+  return nullptr;
+}
 
-UNIMPL_NATIVE_METHOD(getSyncParameter)
+NATIVE_METHOD(getSyncParameter) {
+  auto sync = ARG(0, UEXGLObjectId);
+  auto pname = ARG(1, GLenum);
+  GLint glResult;
+  addBlockingToNextBatch([&] { glGetSynciv(lookupSync(sync), pname, 1, nullptr, &glResult); });
+  return static_cast<double>(glResult);
+}
 
 // Transform feedback (WebGL2)
 // ---------------------------
 
 NATIVE_METHOD(createTransformFeedback) {
-  return exglGenObject(runtime, glGenTransformFeedbacks);
+  return exglGenObject(runtime, EXGLObjectKind::TransformFeedback, glGenTransformFeedbacks);
 }
 
 NATIVE_METHOD(deleteTransformFeedback) {
@@ -1545,7 +1703,7 @@ NATIVE_METHOD(uniformBlockBinding) {
 // ----------------------------
 
 NATIVE_METHOD(createVertexArray) {
-  return exglGenObject(runtime, glGenVertexArrays);
+  return exglGenObject(runtime, EXGLObjectKind::VertexArray, glGenVertexArrays);
 }
 
 NATIVE_METHOD(deleteVertexArray) {
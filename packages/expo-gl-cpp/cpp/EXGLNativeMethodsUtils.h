@@ -1,6 +1,6 @@
 #pragma once
 
-#ifdef __ANDROID__
+#if defined(__ANDROID__) || defined(__linux__)
 #include <GLES3/gl3.h>
 #include <GLES3/gl3ext.h>
 #endif
@@ -39,13 +39,9 @@ inline constexpr bool is_integral_v =
     std::is_integral_v<T> && !std::is_same_v<bool, T> && !std::is_same_v<GLboolean, T>;
 
 template <typename T>
-inline constexpr bool is_supported_vector = std::is_same_v<std::vector<uint32_t>, T> ||
-    std::is_same_v<std::vector<int32_t>, T> || std::is_same_v<std::vector<float>, T>;
-
-template <typename T>
-inline std::
-    enable_if_t<!(is_integral_v<T> || std::is_floating_point_v<T> || is_supported_vector<T>), T>
-    unpackArg(jsi::Runtime &runtime, const jsi::Value *jsArgv);
+inline std::enable_if_t<!(is_integral_v<T> || std::is_floating_point_v<T>), T> unpackArg(
+    jsi::Runtime &runtime,
+    const jsi::Value *jsArgv);
 
 //
 // unpackArgs explicit specializations
@@ -146,31 +142,6 @@ inline std::enable_if_t<std::is_floating_point_v<T>, T> unpackArg(
   return jsArgv->asNumber();
 }
 
-template <typename T>
-inline std::enable_if_t<is_supported_vector<T>, T> unpackArg(
-    jsi::Runtime &runtime,
-    const jsi::Value *jsArgv) {
-  auto jsObj = jsArgv->asObject(runtime);
-  if (jsObj.isArray(runtime)) {
-    return jsArrayToVector<typename T::value_type>(runtime, jsObj.asArray(runtime));
-  } else if (isTypedArray(runtime, jsObj)) {
-    if constexpr (std::is_same_v<typename T::value_type, uint32_t>) {
-      return getTypedArray(runtime, std::move(jsObj))
-          .as<TypedArrayKind::Uint32Array>(runtime)
-          .toVector(runtime);
-    } else if constexpr (std::is_same_v<typename T::value_type, int32_t>) {
-      return getTypedArray(runtime, std::move(jsObj))
-          .as<TypedArrayKind::Int32Array>(runtime)
-          .toVector(runtime);
-    } else if constexpr (std::is_same_v<typename T::value_type, float>) {
-      return getTypedArray(runtime, std::move(jsObj))
-          .as<TypedArrayKind::Float32Array>(runtime)
-          .toVector(runtime);
-    }
-  }
-  throw std::runtime_error("unsupported type");
-}
-
 template <TypedArrayKind T>
 inline TypedArray<T> unpackArg(jsi::Runtime &runtime, const jsi::Value *jsArgv) {
   return getTypedArray(runtime, jsArgv->asObject(runtime)).as<T>(runtime);
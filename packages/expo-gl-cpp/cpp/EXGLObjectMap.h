@@ -0,0 +1,241 @@
+#pragma once
+
+#include "UEXGL.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace expo {
+namespace gl_cpp {
+
+// Kind of the OpenGL object an EXGL object is mapped to. Every kind has a name space of its own,
+// drivers commonly hand out e.g. buffer 1 and texture 1 at the same time.
+enum class EXGLObjectKind : uint8_t {
+  Buffer,
+  Framebuffer,
+  Renderbuffer,
+  Texture,
+  Program,
+  Shader,
+  Query,
+  Sampler,
+  TransformFeedback,
+  VertexArray,
+};
+
+// --- EXGLObjectIdAllocator ---------------------------------------------------
+
+// Hands out the EXGL object ids that JS uses in place of OpenGL object names.
+//
+// The low kIndexBits bits of an id are its index + 1 (so that 0 is never a valid id), the high
+// bits are the generation of the index. Released indices are reused, but with the next
+// generation, so a stale id never matches the object that took over its index. Freed indices are
+// reused in FIFO order, so a generation of a single index wraps around only after every other
+// free index had its turn as well.
+//
+// Ids are shared by all contexts: JS keys its wrapper objects by id without looking at the
+// context, so two live objects must never have the same id. Allocation and release are the only
+// places that take the lock, they happen once per object rather than once per GL call.
+
+class EXGLObjectIdAllocator {
+ public:
+  static constexpr unsigned kIndexBits = 20;
+  static constexpr UEXGLObjectId kIndexMask = (1u << kIndexBits) - 1;
+  static constexpr UEXGLObjectId kGenerationStep = 1u << kIndexBits;
+
+  // Index of the id in the object tables, ids with index bits set to 0 map past any table
+  static inline size_t indexOf(UEXGLObjectId exglObjId) noexcept {
+    return static_cast<size_t>(exglObjId & kIndexMask) - 1;
+  }
+
+  static EXGLObjectIdAllocator &shared() noexcept {
+    static EXGLObjectIdAllocator allocator;
+    return allocator;
+  }
+
+  // Returns 0 once all kIndexMask indices are in use
+  UEXGLObjectId allocate() noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!freeIndices.empty()) {
+      size_t index = freeIndices.front();
+      freeIndices.pop_front();
+      auto &entry = entries[index];
+      entry.id += kGenerationStep;
+      entry.live = true;
+      return entry.id;
+    }
+    if (entries.size() >= kIndexMask) {
+      return 0;
+    }
+    entries.push_back({static_cast<UEXGLObjectId>(entries.size() + 1), true});
+    return entries.back().id;
+  }
+
+  // Ids that aren't live (already released, stale or made up in JS) are ignored
+  void release(UEXGLObjectId exglObjId) noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t index = indexOf(exglObjId);
+    if (index < entries.size() && entries[index].live && entries[index].id == exglObjId) {
+      entries[index].live = false;
+      freeIndices.push_back(index);
+    }
+  }
+
+ private:
+  struct Entry {
+    UEXGLObjectId id; // last id handed out for the index
+    bool live;
+  };
+
+  std::mutex mutex;
+  std::vector<Entry> entries;
+  std::deque<size_t> freeIndices;
+};
+
+// --- EXGLObjectMap -----------------------------------------------------------
+
+// Mapping of EXGL object ids to OpenGL object names of a single context.
+//
+// Ids are created on the JS thread, the mapping is set and read only on the GL thread, so it
+// doesn't need a lock. It is a flat table indexed by the index bits of the id; every slot
+// remembers the full id it was mapped for, so lookups of stale ids (and ids of other contexts)
+// return 0 instead of the object that reuses the index. Lookups, which happen in nearly every
+// op, are a bounds check, a compare and an indexed load.
+
+class EXGLObjectMap {
+ public:
+  explicit EXGLObjectMap(EXGLObjectIdAllocator &allocator = EXGLObjectIdAllocator::shared())
+      : allocator(allocator) {}
+
+  EXGLObjectMap(const EXGLObjectMap &) = delete;
+  EXGLObjectMap &operator=(const EXGLObjectMap &) = delete;
+
+  // Objects that JS didn't delete go away with the context, let other contexts reuse their ids
+  ~EXGLObjectMap() {
+    for (const auto &slot : slots) {
+      if (slot.id != 0) {
+        allocator.release(slot.id);
+      }
+    }
+    for (const auto &sync : syncs) {
+      allocator.release(sync.first);
+    }
+  }
+
+  // [any thread]
+  inline UEXGLObjectId create() noexcept {
+    return allocator.allocate();
+  }
+
+  // [any thread] Make the id available for reuse. Ops that were queued before still see the old
+  // mapping, ops queued after see the mapping of whatever object reuses the index.
+  inline void release(UEXGLObjectId exglObjId) noexcept {
+    allocator.release(exglObjId);
+  }
+
+  // [GL thread]
+  inline void map(UEXGLObjectId exglObjId, GLuint glObj, EXGLObjectKind kind) noexcept {
+    size_t index = EXGLObjectIdAllocator::indexOf(exglObjId);
+    if (index > EXGLObjectIdAllocator::kIndexMask) {
+      return;
+    }
+    if (index >= slots.size()) {
+      slots.resize(index + 1);
+    }
+    auto &slot = slots[index];
+    if (slot.id != 0) {
+      forgetGLObject(slot);
+    }
+    slot.id = exglObjId;
+    slot.glObj = glObj;
+    slot.kind = kind;
+    if (glObj != 0) {
+      idsByGLObject[glObjectKey(kind, glObj)] = exglObjId;
+    }
+  }
+
+  // [GL thread] Unmap the id, stale ids are ignored
+  inline void unmap(UEXGLObjectId exglObjId) noexcept {
+    size_t index = EXGLObjectIdAllocator::indexOf(exglObjId);
+    if (index < slots.size() && slots[index].id == exglObjId) {
+      forgetGLObject(slots[index]);
+      slots[index] = Slot();
+    }
+  }
+
+  // [GL thread] Returns 0 if the id isn't mapped
+  inline GLuint lookup(UEXGLObjectId exglObjId) const noexcept {
+    size_t index = EXGLObjectIdAllocator::indexOf(exglObjId);
+    return index < slots.size() && slots[index].id == exglObjId ? slots[index].glObj : 0;
+  }
+
+  // [GL thread] Sync objects aren't named by a GLuint, they are kept apart from the table. The id
+  // space is shared with other objects.
+  inline void mapSync(UEXGLObjectId exglObjId, GLsync glSync) noexcept {
+    syncs[exglObjId] = glSync;
+  }
+
+  // [GL thread]
+  inline void unmapSync(UEXGLObjectId exglObjId) noexcept {
+    syncs.erase(exglObjId);
+  }
+
+  // [GL thread] Returns nullptr if the id isn't mapped
+  inline GLsync lookupSync(UEXGLObjectId exglObjId) const noexcept {
+    auto iter = syncs.find(exglObjId);
+    return iter == syncs.end() ? nullptr : iter->second;
+  }
+
+  // [GL thread] Unmap and release all sync objects JS didn't delete and return them, so they can
+  // be deleted while the OpenGL context is still current
+  std::vector<GLsync> takeSyncs() noexcept {
+    std::vector<GLsync> glSyncs;
+    glSyncs.reserve(syncs.size());
+    for (const auto &sync : syncs) {
+      allocator.release(sync.first);
+      glSyncs.push_back(sync.second);
+    }
+    syncs.clear();
+    return glSyncs;
+  }
+
+  // [GL thread] Reverse lookup, returns 0 if there is no EXGL object mapped to the given OpenGL
+  // object of the given kind
+  inline UEXGLObjectId find(GLuint glObj, EXGLObjectKind kind) const noexcept {
+    if (glObj == 0) {
+      return 0;
+    }
+    auto iter = idsByGLObject.find(glObjectKey(kind, glObj));
+    return iter == idsByGLObject.end() ? 0 : iter->second;
+  }
+
+ private:
+  struct Slot {
+    UEXGLObjectId id = 0;
+    GLuint glObj = 0;
+    EXGLObjectKind kind = EXGLObjectKind::Buffer;
+  };
+
+  static inline uint64_t glObjectKey(EXGLObjectKind kind, GLuint glObj) noexcept {
+    return static_cast<uint64_t>(kind) << 32 | glObj;
+  }
+
+  inline void forgetGLObject(const Slot &slot) noexcept {
+    auto iter = idsByGLObject.find(glObjectKey(slot.kind, slot.glObj));
+    if (iter != idsByGLObject.end() && iter->second == slot.id) {
+      idsByGLObject.erase(iter);
+    }
+  }
+
+  EXGLObjectIdAllocator &allocator;
+  std::vector<Slot> slots;
+  std::unordered_map<uint64_t, UEXGLObjectId> idsByGLObject;
+  std::unordered_map<UEXGLObjectId, GLsync> syncs;
+};
+
+} // namespace gl_cpp
+} // namespace expo
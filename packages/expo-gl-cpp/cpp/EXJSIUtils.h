@@ -32,16 +32,6 @@ inline std::vector<std::string> jsArrayToVector(jsi::Runtime &runtime, const jsi
   return strings;
 }
 
-inline std::vector<uint8_t> rawTypedArray(jsi::Runtime &runtime, const jsi::Object &arr) {
-  if (arr.isArrayBuffer(runtime)) {
-    auto buffer = arr.getArrayBuffer(runtime);
-    return arrayBufferToVector(runtime, buffer);
-  } else if (isTypedArray(runtime, arr)) {
-    return getTypedArray(runtime, arr).toVector(runtime);
-  }
-  throw std::runtime_error("Object is not an ArrayBuffer nor a TypedArray");
-}
-
 inline bool jsValueToBool(jsi::Runtime &runtime, const jsi::Value &jsValue) {
   return jsValue.isBool()
       ? jsValue.getBool()
@@ -20,6 +20,8 @@ EXiOSOperatingSystemVersion EXiOSGetOperatingSystemVersion(void);
 
 #ifdef __ANDROID__
 #include <android/log.h>
+#elif defined(__linux__)
+#include <cstdio>
 #endif
 
 #define EXGL_DEBUG // Whether debugging is on
@@ -27,6 +29,8 @@ EXiOSOperatingSystemVersion EXiOSGetOperatingSystemVersion(void);
 #ifdef EXGL_DEBUG
 #ifdef __ANDROID__
 #define EXGLSysLog(fmt, ...) __android_log_print(ANDROID_LOG_ERROR, "EXGL", fmt, ##__VA_ARGS__)
+#elif defined(__linux__)
+#define EXGLSysLog(fmt, ...) fprintf(stderr, "EXGL: " fmt "\n", ##__VA_ARGS__)
 #endif
 #ifdef __APPLE__
 #define EXGLSysLog(fmt, ...) EXiOSLog("EXGL: " fmt, ##__VA_ARGS__)
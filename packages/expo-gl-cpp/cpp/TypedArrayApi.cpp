@@ -1,5 +1,6 @@
 #include "TypedArrayApi.h"
 
+#include <stdexcept>
 #include <unordered_map>
 
 namespace expo {
@@ -117,6 +118,10 @@ jsi::ArrayBuffer TypedArrayBase::getBuffer(jsi::Runtime &runtime) const {
   }
 }
 
+uint8_t *TypedArrayBase::data(jsi::Runtime &runtime) const {
+  return getBuffer(runtime).data(runtime) + byteOffset(runtime);
+}
+
 bool isTypedArray(jsi::Runtime &runtime, const jsi::Object &jsObj) {
   auto jsVal = runtime.global()
                    .getProperty(runtime, propNameIDCache.get(runtime, Prop::ArrayBuffer))
@@ -91,6 +91,8 @@ class TypedArrayBase : public jsi::Object {
 
   std::vector<uint8_t> toVector(jsi::Runtime &runtime);
   jsi::ArrayBuffer getBuffer(jsi::Runtime &runtime) const;
+  // pointer to the first element, it's valid only until control is returned to JS
+  uint8_t *data(jsi::Runtime &runtime) const;
 
  private:
   template <TypedArrayKind>
@@ -35,6 +35,13 @@ void UEXGLContextDrawEnded(UEXGLContextId exglCtxId) {
   }
 }
 
+void UEXGLContextPrepareForDestroy(UEXGLContextId exglCtxId) {
+  auto exglCtx = EXGLContext::ContextGet(exglCtxId);
+  if (exglCtx) {
+    exglCtx->prepareForDestroy();
+  }
+}
+
 void UEXGLContextDestroy(UEXGLContextId exglCtxId) {
   EXGLContext::ContextDestroy(exglCtxId);
 }
@@ -71,7 +78,7 @@ void UEXGLContextDestroyObject(UEXGLContextId exglCtxId, UEXGLObjectId exglObjId
 void UEXGLContextMapObject(UEXGLContextId exglCtxId, UEXGLObjectId exglObjId, GLuint glObj) {
   auto exglCtx = EXGLContext::ContextGet(exglCtxId);
   if (exglCtx) {
-    exglCtx->mapObject(exglObjId, glObj);
+    exglCtx->mapObject(exglObjId, glObj, EXGLObjectKind::Texture);
   }
 }
 
@@ -1,7 +1,8 @@
 #ifndef __UEXGL_H__
 #define __UEXGL_H__
 
-#ifdef __ANDROID__
+// Plain Linux is only used by the headless benchmark harness
+#if defined(__ANDROID__) || defined(__linux__)
 #include <GLES3/gl3.h>
 #endif
 #ifdef __APPLE__
@@ -53,6 +54,11 @@ bool UEXGLContextNeedsRedraw(UEXGLContextId exglCtxId);
 // [GL thread] Tell cpp that we finished drawing to the surface
 void UEXGLContextDrawEnded(UEXGLContextId exglCtxId);
 
+// [GL thread] Perform the queued up GL work and delete the OpenGL objects JS
+// didn't delete that aren't freed with the OpenGL context (sync objects). Call
+// it before UEXGLContextDestroy while the OpenGL context is still current.
+void UEXGLContextPrepareForDestroy(UEXGLContextId exglCtxId);
+
 // [Any thread] Release the resources for an EXGL context. The same id is never
 // reused.
 void UEXGLContextDestroy(UEXGLContextId exglCtxId);
@@ -70,7 +76,7 @@ UEXGLObjectId UEXGLContextCreateObject(UEXGLContextId exglCtxId);
 // [GL thread] Destroy an EXGL object.
 void UEXGLContextDestroyObject(UEXGLContextId exglCtxId, UEXGLObjectId exglObjId);
 
-// [GL thread] Set the underlying OpenGL object an EXGL object maps to.
+// [GL thread] Set the underlying OpenGL texture an EXGL object maps to.
 void UEXGLContextMapObject(UEXGLContextId exglCtxId, UEXGLObjectId exglObjId, GLuint glObj);
 
 // [GL thread] Get the underlying OpenGL object an EXGL object maps to.
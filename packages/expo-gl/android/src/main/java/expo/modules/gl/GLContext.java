@@ -152,7 +152,6 @@ public class GLContext {
   public void destroy() {
     if (mGLThread != null) {
       mManager.deleteContextWithId(mEXGLCtxId);
-      EXGLContextDestroy(mEXGLCtxId);
 
       try {
         mGLThread.interrupt();
@@ -161,6 +160,9 @@ public class GLContext {
         Log.e("EXGL", "Can't interrupt GL thread.", e);
       }
       mGLThread = null;
+
+      // The GL thread is done with the context by now
+      EXGLContextDestroy(mEXGLCtxId);
     }
   }
 
@@ -352,6 +354,10 @@ public class GLContext {
         }
       }
 
+      // Delete objects that would outlive the EGL context while it's still current
+      if (mEXGLCtxId > 0) {
+        EXGLContextPrepareForDestroy(mEXGLCtxId);
+      }
       deinitEGL();
     }
 
@@ -119,8 +119,8 @@
       [self.delegate glContextWillDestroy:self];
     }
 
-    // Flush all the stuff
-    UEXGLContextFlush(self->_contextId);
+    // Flush all the stuff and delete objects that outlive the GL context
+    UEXGLContextPrepareForDestroy(self->_contextId);
 
     // Destroy JS binding
     UEXGLContextDestroy(self->_contextId);
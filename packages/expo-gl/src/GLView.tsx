@@ -461,6 +461,18 @@ const wrapMethods = gl => {
     return orig.call(gl, objectId(sampler), pname);
   });
 
+  // Sync objects
+  wrap('fenceSync', orig => (condition, flags) => {
+    return wrapObject(WebGLSync, orig.call(gl, condition, flags));
+  });
+  wrap('isSync', orig => sync => sync instanceof WebGLSync && orig.call(gl, sync.id));
+  wrap('deleteSync', orig => sync => orig.call(gl, objectId(sync)));
+  wrap('clientWaitSync', orig => (sync, flags, timeout) => {
+    return orig.call(gl, objectId(sync), flags, timeout);
+  });
+  wrap('waitSync', orig => (sync, flags, timeout) => orig.call(gl, objectId(sync), flags, timeout));
+  wrap('getSyncParameter', orig => (sync, pname) => orig.call(gl, objectId(sync), pname));
+
   // Transform feedback
   wrap('bindTransformFeedback', orig => (target, transformFeedback) => {
     return orig.call(gl, target, objectId(transformFeedback));